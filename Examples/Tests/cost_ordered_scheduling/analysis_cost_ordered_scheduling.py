@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that processing the particle tiles by decreasing number
+# of particles (warpx.do_cost_ordered_scheduling = 1), with several OpenMP
+# threads and dynamic scheduling, gives the same result as the reference run,
+# in which the tiles are processed in the order of the grids.
+# If a tile were skipped or processed twice by the threads, the fields and the
+# particle moments would differ.
+# For the DSMC case, the collisions are random and the threads draw different
+# random numbers in the two runs: the weight of each species, the total
+# momentum and the total energy must be conserved by the collisions, while the
+# number of macroparticles created by the collisions (one per collision and
+# species) must match the reference within statistical fluctuations.
+import os
+import re
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+# test name
+test_name = os.path.split(os.getcwd())[1]
+dsmc = re.search("dsmc", test_name) is not None
+
+# this will be the name of the plot file, and of the plot file of the reference run
+fn = sys.argv[1]
+fn_ref = sys.argv[2]
+
+ds = yt.load(fn)
+ds_ref = yt.load(fn_ref)
+ad = ds.all_data()
+ad_ref = ds_ref.all_data()
+
+# fields
+if not dsmc:
+    cg = ds.covering_grid(
+        level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions
+    )
+    cg_ref = ds_ref.covering_grid(
+        level=0, left_edge=ds_ref.domain_left_edge, dims=ds_ref.domain_dimensions
+    )
+    # The tiles deposit their current in a different order in the two runs,
+    # so that the fields only agree up to round-off errors
+    for field in ["Ex", "Ey", "Ez", "Bx", "By", "Bz", "jx", "jy", "jz"]:
+        F = cg["boxlib", field].v
+        F_ref = cg_ref["boxlib", field].v
+        error = np.max(np.abs(F - F_ref)) / np.max(np.abs(F_ref))
+        print(f"{field}: relative error = {error}")
+        assert error < 1e-9
+
+species_names = ["ions", "neutrals"] if dsmc else ["plasma", "beam"]
+
+
+def moments(ad, species):
+    w = ad[species, "particle_weight"].v
+    px = ad[species, "particle_momentum_x"].v
+    py = ad[species, "particle_momentum_y"].v
+    pz = ad[species, "particle_momentum_z"].v
+    return w.size, np.array(
+        [
+            np.sum(w),
+            np.sum(w * px),
+            np.sum(w * py),
+            np.sum(w * pz),
+            np.sum(w * (px**2 + py**2 + pz**2)),
+        ]
+    )
+
+
+if dsmc:
+    # beginning of this run and of the reference run
+    ds0 = yt.load(os.path.join(os.path.dirname(fn), "diag1000000"))
+    ds0_ref = yt.load(os.path.join(os.path.dirname(fn_ref), "diag1000000"))
+    ad0 = ds0.all_data()
+    ad0_ref = ds0_ref.all_data()
+
+    # the weight of each species is conserved, while momentum and energy are only
+    # conserved for the sum of the two species (which have the same mass)
+    total = np.zeros(5)
+    total0 = np.zeros(5)
+    for species in species_names:
+        num, mom = moments(ad, species)
+        num0, mom0 = moments(ad0, species)
+        num_ref, _ = moments(ad_ref, species)
+        num0_ref, _ = moments(ad0_ref, species)
+        total += mom
+        total0 += mom0
+        error = abs(mom[0] - mom0[0]) / mom0[0]
+        print(f"{species}: relative error on the weight = {error}")
+        assert error < 1e-12
+
+        num_new = num - num0
+        num_new_ref = num_ref - num0_ref
+        print(f"{species}: {num_new} new macroparticles ({num_new_ref} in reference)")
+        # the collisions must have happened
+        assert num_new_ref > 1000
+        assert abs(num_new - num_new_ref) < 5.0 * np.sqrt(num_new_ref)
+
+    for i, name in [(1, "px"), (2, "py"), (3, "pz"), (4, "energy")]:
+        # normalize the momentum by (total weight * total energy)^(1/2)
+        norm = np.sqrt(total0[0] * total0[4]) if i < 4 else total0[4]
+        error = abs(total[i] - total0[i]) / norm
+        print(f"total {name}: relative error = {error}")
+        assert error < 1e-9
+else:
+    for species in species_names:
+        num, mom = moments(ad, species)
+        num_ref, mom_ref = moments(ad_ref, species)
+        assert num == num_ref
+        # normalize by the total weight and by the norm of the momentum
+        norm = np.array(
+            [mom_ref[0]] + [np.linalg.norm(mom_ref[1:4])] * 3 + [mom_ref[4]]
+        )
+        error = np.max(np.abs(mom - mom_ref) / norm)
+        print(f"{species}: relative error on the moments = {error}")
+        assert error < 1e-9
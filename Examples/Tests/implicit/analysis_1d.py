@@ -25,6 +25,26 @@ max_delta_E = np.abs(delta_E).max()
 test_name = os.path.split(os.getcwd())[1]
 if re.match("test_1d_semi_implicit_picard", test_name):
     tolerance_rel = 2.5e-5
+elif re.match("test_1d_theta_implicit_picard_rtol", test_name):
+    # The plain Picard iterations stop at a relative tolerance of 1e-10
+    tolerance_rel = 1.0e-8
+elif re.match("test_1d_theta_implicit_picard_anderson", test_name):
+    # The Anderson-accelerated iterations stop at a relative tolerance of 1e-10
+    tolerance_rel = 1.0e-8
+    # and should need fewer iterations than the plain Picard iterations
+    # with the same tolerance (test_1d_theta_implicit_picard_rtol)
+    implicit_iterations = np.loadtxt(
+        "diags/reducedfiles/implicit_iterations.txt", skiprows=1
+    )
+    picard_iterations = np.loadtxt(
+        "../test_1d_theta_implicit_picard_rtol/diags/reducedfiles/implicit_iterations.txt",
+        skiprows=1,
+    )
+    mean_iterations = implicit_iterations[1:, 2].mean()
+    mean_picard_iterations = picard_iterations[1:, 2].mean()
+    print(f"mean number of Anderson-accelerated iterations: {mean_iterations}")
+    print(f"mean number of plain Picard iterations: {mean_picard_iterations}")
+    assert mean_iterations < 0.8 * mean_picard_iterations
 elif re.match("test_1d_theta_implicit_picard", test_name):
     # This case should have near machine precision conservation of energy
     tolerance_rel = 1.0e-14
@@ -10,6 +10,8 @@
 # This is a script that analyses the simulation results from the script `inputs_vandb_2d`.
 # This simulates a 2D periodic plasma using the implicit solver
 # with the Villasenor deposition using shape factor 2.
+import os
+import re
 import sys
 
 import numpy as np
@@ -28,6 +30,26 @@ max_delta_E = np.abs(delta_E).max()
 tolerance_rel_energy = 2.0e-14
 tolerance_rel_charge = 2.0e-15
 
+test_name = os.path.split(os.getcwd())[1]
+if re.match("test_2d_theta_implicit_newton_lumped_mass_vandb", test_name):
+    # The approximate Jacobian slows down the convergence of the Newton iterations
+    # (which are required to converge within newton.max_iterations = 40)
+    tolerance_rel_energy = 1.0e-12
+    implicit_iterations = np.loadtxt(
+        "diags/reducedfiles/implicit_iterations.txt", skiprows=1
+    )
+    mean_newton_iterations = implicit_iterations[1:, 4].mean()
+    mean_gmres_iterations = implicit_iterations[1:, 5].mean() / mean_newton_iterations
+    mean_reuse_rate = implicit_iterations[1:, 6].mean()
+    print(f"mean number of Newton iterations per step: {mean_newton_iterations}")
+    print(f"mean number of GMRES iterations per Newton iteration: {mean_gmres_iterations}")
+    print(f"mean reuse rate of the Jacobian: {mean_reuse_rate}")
+    # The particle response of the Jacobian must actually be reused
+    assert mean_reuse_rate > 0.0
+    # and the iterations should remain well below their maximum numbers
+    assert mean_newton_iterations < 30
+    assert mean_gmres_iterations < 100
+
 print(f"max change in energy: {max_delta_E}")
 print(f"tolerance: {tolerance_rel_energy}")
 
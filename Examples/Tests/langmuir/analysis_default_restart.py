@@ -0,0 +1 @@
+../../analysis_default_restart.py
\ No newline at end of file
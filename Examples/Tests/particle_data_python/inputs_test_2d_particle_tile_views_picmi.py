@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+from pywarpx import callbacks, libwarpx, particle_containers, picmi
+
+##########################
+# numerics parameters
+##########################
+
+dt = 7.5e-10
+
+# --- Nb time steps
+
+max_steps = 10
+
+# --- grid
+
+nx = 64
+ny = 64
+
+xmin = 0
+xmax = 0.03
+ymin = 0
+ymax = 0.03
+
+##########################
+# numerics components
+##########################
+
+grid = picmi.Cartesian2DGrid(
+    number_of_cells=[nx, ny],
+    lower_bound=[xmin, ymin],
+    upper_bound=[xmax, ymax],
+    lower_boundary_conditions=["dirichlet", "periodic"],
+    upper_boundary_conditions=["dirichlet", "periodic"],
+    lower_boundary_conditions_particles=["absorbing", "periodic"],
+    upper_boundary_conditions_particles=["absorbing", "periodic"],
+    moving_window_velocity=None,
+    warpx_max_grid_size=32,
+)
+
+solver = picmi.ElectrostaticSolver(
+    grid=grid,
+    method="Multigrid",
+    required_precision=1e-6,
+    warpx_self_fields_verbosity=0,
+)
+
+##########################
+# physics components
+##########################
+
+electrons = picmi.Species(particle_type="electron", name="electrons")
+
+##########################
+# diagnostics
+##########################
+
+particle_diag = picmi.ParticleDiagnostic(
+    name="diag1",
+    period=10,
+)
+field_diag = picmi.FieldDiagnostic(
+    name="diag1",
+    grid=grid,
+    period=10,
+    data_list=["phi"],
+)
+
+##########################
+# simulation setup
+##########################
+
+sim = picmi.Simulation(solver=solver, time_step_size=dt, max_steps=max_steps, verbose=1)
+
+sim.add_species(
+    electrons, layout=picmi.GriddedLayout(n_macroparticle_per_cell=[0, 0], grid=grid)
+)
+sim.add_diagnostic(particle_diag)
+sim.add_diagnostic(field_diag)
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+##########################
+# python particle data access
+##########################
+
+np.random.seed(30025025)
+
+elec_wrapper = particle_containers.ParticleContainerWrapper("electrons")
+
+my_id = libwarpx.amr.ParallelDescriptor.MyProc()
+
+nps = 10 * (my_id + 1)
+elec_wrapper.add_particles(
+    x=np.linspace(0.005, 0.025, nps),
+    y=np.zeros(nps),
+    z=np.linspace(0.005, 0.025, nps),
+    ux=np.random.normal(loc=0, scale=1e3, size=nps),
+    uy=np.random.normal(loc=0, scale=1e3, size=nps),
+    uz=np.random.normal(loc=0, scale=1e3, size=nps),
+    w=np.ones(nps) * 2.0,
+)
+
+stale_views = []
+
+
+def scale_weight():
+    # the weights of all the tiles are doubled in place, without copy
+    views = elec_wrapper.get_particle_tile_views(comp_names=["w"])
+    assert views.valid
+
+    def double(w):
+        w *= 2.0
+
+    views.apply(double, "w")
+
+    for w in elec_wrapper.get_particle_real_arrays("w", 0):
+        assert np.all(w == w[0])
+
+    stale_views.append(views)
+
+
+callbacks.installafterstep(scale_weight)
+
+##########################
+# simulation run
+##########################
+
+sim.step(max_steps)
+
+##########################
+# check the modified weights and
+# the invalidation of the views
+##########################
+
+for w in elec_wrapper.get_particle_real_arrays("w", 0):
+    assert np.allclose(w, 2.0 * 2**max_steps)
+
+# the views obtained in the callbacks are not valid anymore
+assert not any(views.valid for views in stale_views)
+try:
+    len(stale_views[-1])
+except RuntimeError:
+    pass
+else:
+    raise AssertionError("invalid particle tile views were not detected")
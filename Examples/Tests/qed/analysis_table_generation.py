@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This script checks that the QED lookup tables generated in parallel
+# (i.e., with the sub-tables generated concurrently on different MPI ranks
+# and then broadcast) are bitwise identical to the tables generated
+# by a single MPI rank with the same control parameters.
+
+import sys
+
+serial_dir = sys.argv[1]
+
+for table_name in ["bw_table", "qs_table"]:
+    with open(table_name, "rb") as f:
+        parallel_table = f.read()
+    with open(f"{serial_dir}/{table_name}", "rb") as f:
+        serial_table = f.read()
+    print(f"{table_name}: {len(parallel_table)} bytes (parallel), {len(serial_table)} bytes (serial)")
+    assert len(parallel_table) > 0
+    assert parallel_table == serial_table
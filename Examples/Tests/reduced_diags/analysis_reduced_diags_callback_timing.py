@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This script tests the reduced diagnostics `CallbackTiming`.
+# The simulation installs an `afterstep` callback that sleeps for 0.05 s and
+# only runs every other step (with `setcallbackintervals`).
+# The test checks that the time spent in this callback is reported at these
+# steps only, and that the total time includes it.
+
+import sys
+
+import numpy as np
+
+# Command line argument (unused)
+fn = sys.argv[1]
+
+# Load data: step, time, total, then the time of each callback location
+with open("./diags/reducedfiles/CT.txt") as f:
+    header = f.readline().lstrip("#").split()
+data = np.atleast_2d(np.genfromtxt("./diags/reducedfiles/CT.txt"))
+columns = {name.split("]")[1]: i for i, name in enumerate(header)}
+
+step = data[:, columns["step()"]]
+total = data[:, columns["total(s)"]]
+afterstep = data[:, columns["afterstep(s)"]]
+
+# the diagnostic is written at each step, after the afterstep callback:
+# the afterstep callback ran at the even steps (2, 4, 6) only
+ran = step % 2 == 0
+assert np.all(afterstep[ran] >= 0.05)
+assert np.all(afterstep[~ran] == 0.0)
+
+# the total includes all the locations
+assert np.all(total >= afterstep)
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This script tests the reduced diagnostics `ParticleMemory`, together with
+# the particle tile pool (`particles.tile_pool = 1`).
+# The setup is a uniform plasma of thermal electrons, which move between tiles.
+# The test checks that the number of particles is conserved, that the tiles
+# always have enough capacity for their particles, and that the pool has been
+# used to grow the tiles.
+# In the "shrink" test, a beam leaves the domain through an absorbing boundary,
+# so that its tiles empty out. The test then also checks that the pool only
+# shrinks the tiles after particles.tile_pool_shrink_delay steps, and that the
+# capacity of the tiles comes back close to the number of particles.
+
+import os
+import re
+import sys
+
+import numpy as np
+
+# Command line argument (unused)
+fn = sys.argv[1]
+
+# test name
+test_name = os.path.split(os.getcwd())[1]
+shrink = re.search("shrink", test_name) is not None
+
+# Load data: step, time, num_tiles, num_particles, capacity, used, reserved,
+# num_grow, num_shrink, num_realloc
+data = np.genfromtxt("./diags/reducedfiles/PM.txt")
+step = data[:, 0]
+num_tiles = data[:, 2]
+num_particles = data[:, 3]
+capacity = data[:, 4]
+used = data[:, 5]
+reserved = data[:, 6]
+num_grow = data[:, 7]
+num_shrink = data[:, 8]
+num_realloc = data[:, 9]
+
+if shrink:
+    # the beam has left the domain
+    assert num_particles[-1] < num_particles[0]
+else:
+    # periodic domain: the number of particles is conserved
+    assert np.all(num_particles == num_particles[0])
+
+# the tiles can always hold their particles
+assert np.all(capacity >= num_particles)
+assert np.all(reserved >= used)
+
+# the pool statistics are cumulative, and the pool has grown the tiles
+assert np.all(np.diff(num_grow) >= 0)
+assert np.all(np.diff(num_shrink) >= 0)
+assert np.all(np.diff(num_realloc) >= 0)
+assert num_grow[-1] > 0
+
+if shrink:
+    # parameters of the tile pool, from the input file
+    slab_size = 64
+    spare_fraction = 0.2
+    shrink_delay = 2
+
+    # A tile is only shrunk after it has been oversized for more than
+    # shrink_delay consecutive calls to Redistribute (one per step). All the
+    # tiles of the beam (one layer of tiles along z) hold the same number of
+    # particles, so they are shrunk at the same steps, which must be separated
+    # by more than shrink_delay steps.
+    assert np.all(num_shrink[step <= shrink_delay] == 0)
+    assert num_shrink[-1] > 0
+    shrink_steps = step[1:][np.diff(num_shrink) > 0]
+    print(f"steps at which tiles were shrunk: {shrink_steps}")
+    assert np.all(np.diff(shrink_steps) > shrink_delay)
+
+    # The capacity was reduced once the beam left, and it came back close to the
+    # number of particles: after the shrink, each tile holds at most twice its
+    # capacity class, which is at most 1.5 times the number of particles
+    # (plus the spare fraction), or one slab
+    assert capacity[-1] < np.max(capacity)
+    capacity_bound = 2 * (
+        1.5 * (1 + spare_fraction) * num_particles[-1] + slab_size * num_tiles[-1]
+    )
+    print(f"final capacity = {capacity[-1]}, bound = {capacity_bound}")
+    assert capacity[-1] <= capacity_bound
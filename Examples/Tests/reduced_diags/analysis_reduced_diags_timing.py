@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This script tests the reduced diagnostics `Timing`.
+# The test checks that the minimum, average and maximum over the MPI ranks
+# are ordered, that the times of the phases add up to the total time, and
+# that time is spent in the particle and field solve phases at each step.
+
+import sys
+
+import numpy as np
+
+# Command line argument (unused)
+fn = sys.argv[1]
+
+phases = [
+    "particles",
+    "communication",
+    "field_solve",
+    "collisions",
+    "diagnostics",
+    "load_balance",
+    "other",
+]
+
+# Load data: step, time, then (min, avg, max) of the total and of each phase
+data = np.genfromtxt("./diags/reducedfiles/TIM.txt")
+times = data[:, 2:].reshape(data.shape[0], len(phases) + 1, 3)
+tmin = times[:, :, 0]
+tavg = times[:, :, 1]
+tmax = times[:, :, 2]
+
+assert np.all(tmin >= 0.0)
+assert np.all(tmin <= tavg * (1.0 + 1e-12))
+assert np.all(tavg <= tmax * (1.0 + 1e-12))
+
+# the phases add up to the total time
+assert np.allclose(tavg[:, 0], np.sum(tavg[:, 1:], axis=1), rtol=1e-6)
+
+# the particles are pushed and the fields are evolved at each step
+steps = data[:, 0] > 0
+assert np.all(tavg[steps, 1 + phases.index("particles")] > 0.0)
+assert np.all(tavg[steps, 1 + phases.index("field_solve")] > 0.0)
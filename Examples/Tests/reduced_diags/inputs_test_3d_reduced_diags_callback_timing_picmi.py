@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+
+import time
+
+from pywarpx import callbacks, picmi
+
+# Number of time steps
+max_steps = 6
+
+# Number of cells
+nx = 16
+ny = 16
+nz = 16
+
+# Physical domain
+xmin = 0.0
+xmax = 4.0
+ymin = 0.0
+ymax = 4.0
+zmin = 0.0
+zmax = 4.0
+
+# Create grid
+grid = picmi.Cartesian3DGrid(
+    number_of_cells=[nx, ny, nz],
+    warpx_max_grid_size=8,
+    lower_bound=[xmin, ymin, zmin],
+    upper_bound=[xmax, ymax, zmax],
+    lower_boundary_conditions=["periodic", "periodic", "periodic"],
+    upper_boundary_conditions=["periodic", "periodic", "periodic"],
+)
+
+# Electromagnetic solver
+solver = picmi.ElectromagneticSolver(grid=grid, method="Yee", cfl=0.99999)
+
+# Particles
+electrons = picmi.Species(
+    particle_type="electron",
+    name="electrons",
+    initial_distribution=picmi.UniformDistribution(
+        density=1e14, rms_velocity=[0] * 3, upper_bound=[xmax, ymax, 1.0]
+    ),
+)
+layout = picmi.GriddedLayout(n_macroparticle_per_cell=[1, 1, 1], grid=grid)
+
+# Reduced diagnostic
+callback_timing = picmi.ReducedDiagnostic(
+    diag_type="CallbackTiming", period=1, name="CT"
+)
+
+# Set up simulation
+sim = picmi.Simulation(
+    solver=solver,
+    max_steps=max_steps,
+    verbose=1,
+    particle_shape=1,
+)
+
+# Add species
+sim.add_species(electrons, layout=layout)
+
+# Add reduced diagnostics
+sim.add_diagnostic(callback_timing)
+
+# Callbacks: one at every step, and one every other step that takes a known time
+steps_beforestep = []
+steps_afterstep = []
+sleep_time = 0.05
+
+
+@callbacks.callfrombeforestep
+def record_beforestep():
+    steps_beforestep.append(sim.extension.warpx.getistep(lev=0))
+
+
+@callbacks.callfromafterstep
+def record_afterstep():
+    steps_afterstep.append(sim.extension.warpx.getistep(lev=0))
+    time.sleep(sleep_time)
+
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+callbacks.setcallbackintervals("afterstep", "2")
+
+# Advance simulation until last time step
+sim.step(max_steps)
+
+# The afterstep callback only ran at the steps 2, 4 and 6
+assert steps_beforestep == [0, 1, 2, 3, 4, 5]
+assert steps_afterstep == [2, 4, 6]
+
+timers = sim.extension.libwarpx_so.get_python_callback_timers()
+assert timers["beforestep"][1] == max_steps
+assert timers["afterstep"][1] == 3
+assert timers["afterstep"][0] >= 3 * sleep_time
@@ -75,6 +75,20 @@ The above example is quivalent to the following:
 
    # run simulation
    sim.step(nsteps=100)
+
+The functions of a callback location can be restricted to some steps with
+:py:func:`setcallbackintervals`, which takes the same syntax as the ``intervals``
+of the diagnostics. Here, ``myplots`` is only called every 10 steps:
+
+.. code-block:: python3
+
+   from pywarpx.callbacks import installcallback, setcallbackintervals
+
+   installcallback('afterstep', myplots)
+   setcallbackintervals('afterstep', '10')
+
+The wall time spent in the callbacks of each location is accumulated in WarpX and
+can be written with the ``CallbackTiming`` reduced diagnostic.
 """
 
 import copy
@@ -328,6 +342,19 @@ def isinstalled(name, f):
     return callback_instances[name].isinstalledfuncinlist(f)
 
 
+def setcallbackintervals(name, intervals=None):
+    """Restricts the calls of the functions of this callback to the given steps.
+
+    intervals is a string (or list of strings) with the syntax of the ``intervals``
+    of the diagnostics, where the step is the number of the step being computed
+    (starting at 1). If None, the functions are called at every step."""
+    if intervals is None:
+        intervals = []
+    elif isinstance(intervals, str):
+        intervals = [intervals]
+    libwarpx.libwarpx_so.set_python_callback_intervals(name, list(intervals))
+
+
 def clear_all():
     for key, val in callback_instances.items():
         val.clearlist()
@@ -365,6 +365,46 @@ class ParticleContainerWrapper(object):
 
         return data_array
 
+    def get_particle_tile_views(self, level=0, comp_names=None):
+        """
+        This returns views of the particle arrays of each tile for this process,
+        without copy: the arrays (numpy arrays, or cupy arrays on GPU) share
+        the underlying memory buffer with WarpX, and are fully writeable.
+        Several components of all the tiles can thus be read and modified
+        in place without any copy (see ``ParticleTileViews.apply``).
+
+        The views are only valid until WarpX may move the particles in memory
+        (e.g. in ``Redistribute``, when sorting, adding or removing particles).
+        They must thus be obtained again in each callback, and after adding
+        particles with ``add_particles``. Accessing the tiles of invalid views
+        raises an error; the arrays that were extracted from them must not be used.
+
+        Parameters
+        ----------
+
+        level          : int
+            The refinement level to reference (default=0)
+
+        comp_names     : list of str
+            The real or int components to access (default: all the components).
+            The ``idcpu`` data is always included.
+
+        Returns
+        -------
+
+        ParticleTileViews
+            The views of the arrays of each tile
+        """
+        real_comps = self.particle_container.real_comp_names
+        int_comps = self.particle_container.int_comp_names
+        if comp_names is not None:
+            for name in comp_names:
+                if name not in real_comps and name not in int_comps:
+                    raise ValueError(f"Unknown particle component '{name}'")
+            real_comps = {k: v for k, v in real_comps.items() if k in comp_names}
+            int_comps = {k: v for k, v in int_comps.items() if k in comp_names}
+        return ParticleTileViews(self.particle_container, level, real_comps, int_comps)
+
     def get_particle_idcpu(self, level=0, copy_to_host=False):
         """
         Return a list of numpy or cupy arrays containing the particle 'idcpu'
@@ -762,6 +802,79 @@ class ParticleContainerWrapper(object):
             libwarpx.warpx.sync_rho()
 
 
+class ParticleTileViews(object):
+    """Views of the particle arrays of the tiles of a species, for this process,
+    without copy. They are obtained with ``ParticleContainerWrapper.get_particle_tile_views``.
+
+    Each tile is a dictionary that maps the component names to the arrays of the tile.
+    The views become invalid as soon as WarpX may move the particles in memory,
+    i.e. when the simulation advances (at the end of the callback in which they were
+    obtained) or when particles are added.
+    """
+
+    def __init__(self, particle_container, level, real_comps, int_comps):
+        self._generation = libwarpx.libwarpx_so.get_particle_data_generation()
+
+        xp, cupy_status = load_cupy()
+        if cupy_status is not None:
+            libwarpx.amr.Print(cupy_status)
+
+        self._tiles = []
+        for pti in libwarpx.libwarpx_so.WarpXParIter(particle_container, level):
+            soa = pti.soa()
+            tile = {"idcpu": xp.array(soa.get_idcpu_data(), copy=False)}
+            for name, idx in real_comps.items():
+                tile[name] = xp.array(soa.get_real_data(idx), copy=False)
+            for name, idx in int_comps.items():
+                tile[name] = xp.array(soa.get_int_data(idx), copy=False)
+            self._tiles.append(tile)
+
+    @property
+    def valid(self):
+        """Whether the views still point to the particle data of WarpX"""
+        return libwarpx.libwarpx_so.get_particle_data_generation() == self._generation
+
+    def _check_valid(self):
+        if not self.valid:
+            raise RuntimeError(
+                "The particle tile views are not valid anymore: the particles may have "
+                "been moved in memory since they were obtained. "
+                "Call get_particle_tile_views again."
+            )
+
+    def __len__(self):
+        self._check_valid()
+        return len(self._tiles)
+
+    def __getitem__(self, i):
+        self._check_valid()
+        return self._tiles[i]
+
+    def __iter__(self):
+        self._check_valid()
+        return iter(self._tiles)
+
+    def apply(self, func, *comp_names):
+        """
+        Calls ``func`` on each tile, with the arrays of the given components
+        as arguments, e.g. ``views.apply(f, "ux", "uy", "uz")`` calls ``f(ux, uy, uz)``.
+        ``func`` can modify the arrays in place (e.g. ``ux *= 2.0``), which
+        directly modifies the particle data of WarpX.
+
+        Parameters
+        ----------
+
+        func           : callable
+            The function to be called on each tile
+
+        comp_names     : str
+            The components passed to ``func``
+        """
+        self._check_valid()
+        for tile in self._tiles:
+            func(*[tile[name] for name in comp_names])
+
+
 class ParticleBoundaryBufferWrapper(object):
     """Wrapper around particle boundary buffer containers.
     This provides a convenient way to query data in the particle boundary
@@ -4080,6 +4080,8 @@ class ReducedDiagnostic(picmistandard.base._ClassWithInit, WarpXDiagnosticBase):
             "LoadBalanceCosts",
             "LoadBalanceEfficiency",
             "Timestep",
+            "CallbackTiming",
+            "Timing",
         ]
         # The species diagnostics require a species to be provided
         self._species_reduced_diagnostics = [
@@ -0,0 +1,199 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "CPML.H"
+
+#include "Utils/TextMsg.H"
+#include "Utils/WarpXConst.H"
+
+#include <AMReX_Box.H>
+#include <AMReX_BoxList.H>
+#include <AMReX_GpuDevice.H>
+#include <AMReX_VisMF.H>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace amrex;
+using namespace amrex::literals;
+
+CPML::CPML (const BoxArray& grid_ba, const DistributionMapping& grid_dm,
+            const Geometry& geom,
+            const IntVect& do_cpml_lo, const IntVect& do_cpml_hi,
+            int ncell, int order, Real reflection,
+            const std::array<IndexType,3>& E_ixtypes,
+            const std::array<IndexType,3>& B_ixtypes)
+{
+    const Box& domain = geom.Domain();
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(ncell > 0 && order >= 0 && reflection > 0._rt && reflection < 1._rt,
+        "CPML: warpx.cpml_ncell must be positive, warpx.cpml_order non-negative and warpx.cpml_reflection between 0 and 1");
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        m_lo[idim] = domain.smallEnd(idim);
+        m_dt_E[idim] = -1._rt;
+        m_dt_B[idim] = -1._rt;
+
+        const int n = domain.length(idim);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            n >= (do_cpml_lo[idim] + do_cpml_hi[idim]) * ncell,
+            "CPML: the domain is thinner than the CPML layers");
+
+        // Polynomial grading of sigma, from 0 at the inner boundary of a layer
+        // to sigma_max at the outer boundary (the boundary of the domain)
+        const Real dx = geom.CellSize(idim);
+        const Real thickness = static_cast<Real>(ncell) * dx;
+        const Real sigma_max = -static_cast<Real>(order + 1) * std::log(reflection) * PhysConst::c
+                               / (2._rt * thickness);
+        for (int s = 0; s < 2; ++s) {
+            m_sigma[idim][s].resize(n + 1, 0._rt);
+            for (int i = 0; i <= n; ++i) {
+                // Position in number of cells from the lower boundary of the domain:
+                // the nodes (s = 1) are at integer positions, the cell centers (s = 0) in between
+                const Real x = static_cast<Real>(i) + ((s == 1) ? 0._rt : 0.5_rt);
+                Real depth = 0._rt;
+                if (do_cpml_lo[idim] && x < static_cast<Real>(ncell)) {
+                    depth = (static_cast<Real>(ncell) - x) / static_cast<Real>(ncell);
+                } else if (do_cpml_hi[idim] && x > static_cast<Real>(n - ncell)) {
+                    depth = (x - static_cast<Real>(n - ncell)) / static_cast<Real>(ncell);
+                }
+                if (depth > 0._rt) {
+                    m_sigma[idim][s][i] = sigma_max * std::pow(depth, static_cast<Real>(order));
+                }
+            }
+        }
+
+        // Parts of the grids that overlap with the layers along idim
+        BoxList patches;
+        Vector<int> pmap;
+        for (int side = 0; side < 2; ++side) {
+            if (!((side == 0) ? do_cpml_lo[idim] : do_cpml_hi[idim])) { continue; }
+            Box layer = domain;
+            if (side == 0) {
+                layer.setBig(idim, domain.smallEnd(idim) + ncell - 1);
+            } else {
+                layer.setSmall(idim, domain.bigEnd(idim) - ncell + 1);
+            }
+            for (int i = 0; i < static_cast<int>(grid_ba.size()); ++i) {
+                const Box patch = grid_ba[i] & layer;
+                if (patch.ok()) {
+                    patches.push_back(patch);
+                    pmap.push_back(grid_dm[i]);
+                    m_grid_index[idim].push_back(i);
+                }
+            }
+        }
+        if (patches.isEmpty()) { continue; }
+
+        const BoxArray patch_ba(std::move(patches));
+        const DistributionMapping patch_dm(std::move(pmap));
+        const int p = PhysicalDirection(idim);
+        const std::array<IndexType,n_psi> ixtypes{
+            E_ixtypes[(p+1)%3], E_ixtypes[(p+2)%3], B_ixtypes[(p+1)%3], B_ixtypes[(p+2)%3]};
+        for (int n = 0; n < n_psi; ++n) {
+            m_psi[idim][n] = std::make_unique<MultiFab>(amrex::convert(patch_ba, ixtypes[n]), patch_dm, 1, 0);
+            m_psi[idim][n]->setVal(0._rt);
+        }
+    }
+}
+
+CPMLCoefficients
+CPML::GetCoefficientsE (int idim, Real dt)
+{
+    if (dt != m_dt_E[idim]) {
+        ComputeCoefficients(idim, dt, m_b_E[idim], m_a_E[idim]);
+        m_dt_E[idim] = dt;
+    }
+    CPMLCoefficients coefs;
+    for (int s = 0; s < 2; ++s) {
+        coefs.b[s] = m_b_E[idim][s].data();
+        coefs.a[s] = m_a_E[idim][s].data();
+    }
+    coefs.lo = m_lo[idim];
+    return coefs;
+}
+
+CPMLCoefficients
+CPML::GetCoefficientsB (int idim, Real dt)
+{
+    if (dt != m_dt_B[idim]) {
+        ComputeCoefficients(idim, dt, m_b_B[idim], m_a_B[idim]);
+        m_dt_B[idim] = dt;
+    }
+    CPMLCoefficients coefs;
+    for (int s = 0; s < 2; ++s) {
+        coefs.b[s] = m_b_B[idim][s].data();
+        coefs.a[s] = m_a_B[idim][s].data();
+    }
+    coefs.lo = m_lo[idim];
+    return coefs;
+}
+
+void
+CPML::ComputeCoefficients (int idim, Real dt,
+                           std::array<Gpu::DeviceVector<Real>,2>& b,
+                           std::array<Gpu::DeviceVector<Real>,2>& a)
+{
+    for (int s = 0; s < 2; ++s) {
+        const Vector<Real>& sigma = m_sigma[idim][s];
+        Vector<Real> h_b(sigma.size());
+        Vector<Real> h_a(sigma.size());
+        for (std::size_t i = 0; i < sigma.size(); ++i) {
+            // With kappa = 1 and alpha = 0, a = sigma/(sigma + alpha)*(b - 1) = b - 1
+            h_b[i] = std::exp(-sigma[i] * dt);
+            h_a[i] = h_b[i] - 1._rt;
+        }
+        b[s].resize(h_b.size());
+        a[s].resize(h_a.size());
+        Gpu::copyAsync(Gpu::hostToDevice, h_b.begin(), h_b.end(), b[s].begin());
+        Gpu::copyAsync(Gpu::hostToDevice, h_a.begin(), h_a.end(), a[s].begin());
+    }
+    Gpu::streamSynchronize();
+}
+
+void
+CPML::RemakeDistributionMap (const DistributionMapping& grid_dm)
+{
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        if (!HasDirection(idim)) { continue; }
+
+        Vector<int> pmap(m_grid_index[idim].size());
+        for (std::size_t i = 0; i < pmap.size(); ++i) {
+            pmap[i] = grid_dm[m_grid_index[idim][i]];
+        }
+        const DistributionMapping patch_dm(std::move(pmap));
+        for (auto& psi : m_psi[idim]) {
+            auto new_psi = std::make_unique<MultiFab>(psi->boxArray(), patch_dm, 1, 0);
+            new_psi->ParallelCopy(*psi);
+            psi = std::move(new_psi);
+        }
+    }
+}
+
+void
+CPML::CheckPoint (const std::string& dir) const
+{
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (!HasDirection(idim)) { continue; }
+        for (int n = 0; n < n_psi; ++n) {
+            VisMF::AsyncWrite(*m_psi[idim][n], dir + "_psi_" + std::to_string(idim) + "_" + std::to_string(n));
+        }
+    }
+}
+
+void
+CPML::Restart (const std::string& dir)
+{
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (!HasDirection(idim)) { continue; }
+        for (int n = 0; n < n_psi; ++n) {
+            VisMF::Read(*m_psi[idim][n], dir + "_psi_" + std::to_string(idim) + "_" + std::to_string(n));
+        }
+    }
+}
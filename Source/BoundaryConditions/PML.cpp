@@ -215,6 +215,7 @@ void SigmaBox::define_single (const Box& regdomain, const IntVect& ncell,
             FillLo(sigma[idim], sigma_cumsum[idim],
                    sigma_star[idim], sigma_star_cumsum[idim],
                    olo, ohi, dlo, fac[idim], v_sigma_sb);
+            is_damped[idim] = true;
         }
 
 #if (AMREX_SPACEDIM != 1)
@@ -235,6 +236,7 @@ void SigmaBox::define_single (const Box& regdomain, const IntVect& ncell,
             FillHi(sigma[idim], sigma_cumsum[idim],
                    sigma_star[idim], sigma_star_cumsum[idim],
                    olo, ohi, dhi, fac[idim], v_sigma_sb);
+            is_damped[idim] = true;
         }
     }
 
@@ -313,6 +315,7 @@ void SigmaBox::define_multiple (const Box& box, const BoxArray& grids, const Int
                        sigma_star[idim], sigma_star_cumsum[idim],
                        looverlap.smallEnd(idim), looverlap.bigEnd(idim),
                        grid_box.smallEnd(idim), fac[idim], v_sigma_sb);
+                is_damped[idim] = true;
             }
 
             Box hibox = amrex::adjCellHi(grid_box, idim, ncell[idim]);
@@ -326,6 +329,7 @@ void SigmaBox::define_multiple (const Box& box, const BoxArray& grids, const Int
                        sigma_star[idim],  sigma_star_cumsum[idim],
                        hioverlap.smallEnd(idim), hioverlap.bigEnd(idim),
                        grid_box.bigEnd(idim), fac[idim], v_sigma_sb);
+                is_damped[idim] = true;
             }
 
             WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
@@ -362,6 +366,7 @@ void SigmaBox::define_multiple (const Box& box, const BoxArray& grids, const Int
                        sigma_star[idim],  sigma_star_cumsum[idim],
                        looverlap.smallEnd(idim), looverlap.bigEnd(idim),
                        grid_box.smallEnd(idim), fac[idim], v_sigma_sb);
+                is_damped[idim] = true;
             }
 
             Box hibox = amrex::adjCellHi(grid_box, idim, ncell[idim]);
@@ -371,6 +376,7 @@ void SigmaBox::define_multiple (const Box& box, const BoxArray& grids, const Int
                        sigma_star[idim], sigma_star_cumsum[idim],
                        hioverlap.smallEnd(idim), hioverlap.bigEnd(idim),
                        grid_box.bigEnd(idim), fac[idim], v_sigma_sb);
+                is_damped[idim] = true;
             }
 
             WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
@@ -412,6 +418,7 @@ void SigmaBox::define_multiple (const Box& box, const BoxArray& grids, const Int
                        sigma_star[idim], sigma_star_cumsum[idim],
                        looverlap.smallEnd(idim), looverlap.bigEnd(idim),
                        grid_box.smallEnd(idim), fac[idim], v_sigma_sb);
+                is_damped[idim] = true;
             }
 
             const Box& hibox = amrex::adjCellHi(grid_box, idim, ncell[idim]);
@@ -421,6 +428,7 @@ void SigmaBox::define_multiple (const Box& box, const BoxArray& grids, const Int
                        sigma_star[idim], sigma_star_cumsum[idim],
                        hioverlap.smallEnd(idim), hioverlap.bigEnd(idim),
                        grid_box.bigEnd(idim), fac[idim], v_sigma_sb);
+                is_damped[idim] = true;
             }
 
             WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
@@ -508,6 +516,30 @@ SigmaBox::ComputePMLFactorsE (const Real* a_dx, Real dt)
     });
 }
 
+PMLDampingFactors
+SigmaBox::GetDampingFactors () const
+{
+    PMLDampingFactors f;
+    auto set_direction = [&] (int idim, const Real*& fac, const Real*& star_fac, int& lo) {
+        lo = sigma_fac[idim].lo();
+        if (is_damped[idim]) {
+            fac = sigma_fac[idim].data();
+            star_fac = sigma_star_fac[idim].data();
+        }
+    };
+#if defined(WARPX_DIM_3D)
+    set_direction(0, f.sigma_fac_x, f.sigma_star_fac_x, f.x_lo);
+    set_direction(1, f.sigma_fac_y, f.sigma_star_fac_y, f.y_lo);
+    set_direction(2, f.sigma_fac_z, f.sigma_star_fac_z, f.z_lo);
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+    set_direction(0, f.sigma_fac_x, f.sigma_star_fac_x, f.x_lo);
+    set_direction(1, f.sigma_fac_z, f.sigma_star_fac_z, f.z_lo);
+#else
+    set_direction(0, f.sigma_fac_z, f.sigma_star_fac_z, f.z_lo);
+#endif
+    return f;
+}
+
 MultiSigmaBox::MultiSigmaBox (const BoxArray& ba, const DistributionMapping& dm,
                               const BoxArray* grid_ba, const Real* dx,
                               const IntVect& ncell, const IntVect& delta,
@@ -554,7 +586,7 @@ PML::PML (const int lev, const BoxArray& grid_ba,
           int ncell, int delta, amrex::IntVect ref_ratio,
           Real dt, int nox_fft, int noy_fft, int noz_fft,
           ablastr::utils::enums::GridType grid_type,
-          int do_moving_window, int /*pml_has_particles*/, int do_pml_in_domain,
+          int do_moving_window, int pml_has_particles, int do_pml_in_domain,
           const PSATDSolutionType psatd_solution_type,
           const JInTime J_in_time, const RhoInTime rho_in_time,
           const bool do_pml_dive_cleaning, const bool do_pml_divb_cleaning,
@@ -720,12 +752,15 @@ PML::PML (const int lev, const BoxArray& grid_ba,
     warpx.m_fields.alloc_init(FieldType::pml_B_fp, Direction{1}, lev, ba_By, dm, ncompb, ngb, 0.0_rt, false, false);
     warpx.m_fields.alloc_init(FieldType::pml_B_fp, Direction{2}, lev, ba_Bz, dm, ncompb, ngb, 0.0_rt, false, false);
 
-    const amrex::BoxArray ba_jx = amrex::convert(ba, WarpX::GetInstance().m_fields.get(FieldType::current_fp, Direction{0}, 0)->ixType().toIntVect());
-    const amrex::BoxArray ba_jy = amrex::convert(ba, WarpX::GetInstance().m_fields.get(FieldType::current_fp, Direction{1}, 0)->ixType().toIntVect());
-    const amrex::BoxArray ba_jz = amrex::convert(ba, WarpX::GetInstance().m_fields.get(FieldType::current_fp, Direction{2}, 0)->ixType().toIntVect());
-    warpx.m_fields.alloc_init(FieldType::pml_j_fp, Direction{0}, lev, ba_jx, dm, 1, ngb, 0.0_rt, false, false);
-    warpx.m_fields.alloc_init(FieldType::pml_j_fp, Direction{1}, lev, ba_jy, dm, 1, ngb, 0.0_rt, false, false);
-    warpx.m_fields.alloc_init(FieldType::pml_j_fp, Direction{2}, lev, ba_jz, dm, 1, ngb, 0.0_rt, false, false);
+    // The current in the PML is only deposited by the particles that enter the PML
+    if (pml_has_particles) {
+        const amrex::BoxArray ba_jx = amrex::convert(ba, WarpX::GetInstance().m_fields.get(FieldType::current_fp, Direction{0}, 0)->ixType().toIntVect());
+        const amrex::BoxArray ba_jy = amrex::convert(ba, WarpX::GetInstance().m_fields.get(FieldType::current_fp, Direction{1}, 0)->ixType().toIntVect());
+        const amrex::BoxArray ba_jz = amrex::convert(ba, WarpX::GetInstance().m_fields.get(FieldType::current_fp, Direction{2}, 0)->ixType().toIntVect());
+        warpx.m_fields.alloc_init(FieldType::pml_j_fp, Direction{0}, lev, ba_jx, dm, 1, ngb, 0.0_rt, false, false);
+        warpx.m_fields.alloc_init(FieldType::pml_j_fp, Direction{1}, lev, ba_jy, dm, 1, ngb, 0.0_rt, false, false);
+        warpx.m_fields.alloc_init(FieldType::pml_j_fp, Direction{2}, lev, ba_jz, dm, 1, ngb, 0.0_rt, false, false);
+    }
 
 #ifdef AMREX_USE_EB
     if (eb_enabled) {
@@ -874,12 +909,14 @@ PML::PML (const int lev, const BoxArray& grid_ba,
             warpx.m_fields.alloc_init(FieldType::pml_G_cp, lev, cba_G_nodal, cdm, 3, ngf, 0.0_rt, false, false);
         }
 
-        const amrex::BoxArray cba_jx = amrex::convert(cba, WarpX::GetInstance().m_fields.get(FieldType::current_cp, Direction{0}, 1)->ixType().toIntVect());
-        const amrex::BoxArray cba_jy = amrex::convert(cba, WarpX::GetInstance().m_fields.get(FieldType::current_cp, Direction{1}, 1)->ixType().toIntVect());
-        const amrex::BoxArray cba_jz = amrex::convert(cba, WarpX::GetInstance().m_fields.get(FieldType::current_cp, Direction{2}, 1)->ixType().toIntVect());
-        warpx.m_fields.alloc_init(FieldType::pml_j_cp, Direction{0}, lev, cba_jx, cdm, 1, ngb, 0.0_rt, false, false);
-        warpx.m_fields.alloc_init(FieldType::pml_j_cp, Direction{1}, lev, cba_jy, cdm, 1, ngb, 0.0_rt, false, false);
-        warpx.m_fields.alloc_init(FieldType::pml_j_cp, Direction{2}, lev, cba_jz, cdm, 1, ngb, 0.0_rt, false, false);
+        if (pml_has_particles) {
+            const amrex::BoxArray cba_jx = amrex::convert(cba, WarpX::GetInstance().m_fields.get(FieldType::current_cp, Direction{0}, 1)->ixType().toIntVect());
+            const amrex::BoxArray cba_jy = amrex::convert(cba, WarpX::GetInstance().m_fields.get(FieldType::current_cp, Direction{1}, 1)->ixType().toIntVect());
+            const amrex::BoxArray cba_jz = amrex::convert(cba, WarpX::GetInstance().m_fields.get(FieldType::current_cp, Direction{2}, 1)->ixType().toIntVect());
+            warpx.m_fields.alloc_init(FieldType::pml_j_cp, Direction{0}, lev, cba_jx, cdm, 1, ngb, 0.0_rt, false, false);
+            warpx.m_fields.alloc_init(FieldType::pml_j_cp, Direction{1}, lev, cba_jy, cdm, 1, ngb, 0.0_rt, false, false);
+            warpx.m_fields.alloc_init(FieldType::pml_j_cp, Direction{2}, lev, cba_jz, cdm, 1, ngb, 0.0_rt, false, false);
+        }
 
         single_domain_box = is_single_box_domain ? cdomain : Box();
         sigba_cp = std::make_unique<MultiSigmaBox>(cba, cdm, &grid_cba_reduced, cgeom->CellSize(),
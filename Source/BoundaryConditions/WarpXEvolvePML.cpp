@@ -44,22 +44,22 @@
 using namespace amrex;
 
 void
-WarpX::DampPML ()
+WarpX::DampPML (const bool damp_B)
 {
     for (int lev = 0; lev <= finest_level; ++lev) {
-        DampPML(lev);
+        DampPML(lev, damp_B);
     }
 }
 
 void
-WarpX::DampPML (const int lev)
+WarpX::DampPML (const int lev, const bool damp_B)
 {
-    DampPML(lev, PatchType::fine);
-    if (lev > 0) { DampPML(lev, PatchType::coarse); }
+    DampPML(lev, PatchType::fine, damp_B);
+    if (lev > 0) { DampPML(lev, PatchType::coarse, damp_B); }
 }
 
 void
-WarpX::DampPML (const int lev, PatchType patch_type)
+WarpX::DampPML (const int lev, PatchType patch_type, const bool damp_B)
 {
     if (!do_pml) { return; }
 
@@ -76,12 +76,12 @@ WarpX::DampPML (const int lev, PatchType patch_type)
     }
 #endif
     if (pml[lev]) {
-        DampPML_Cartesian (lev, patch_type);
+        DampPML_Cartesian (lev, patch_type, damp_B);
     }
 }
 
 void
-WarpX::DampPML_Cartesian (const int lev, PatchType patch_type)
+WarpX::DampPML_Cartesian (const int lev, PatchType patch_type, const bool damp_B)
 {
     const bool dive_cleaning = WarpX::do_pml_dive_cleaning;
     const bool divb_cleaning = WarpX::do_pml_divb_cleaning;
@@ -135,30 +135,17 @@ WarpX::DampPML_Cartesian (const int lev, PatchType patch_type)
             auto const& pml_Byfab = pml_B[1]->array(mfi);
             auto const& pml_Bzfab = pml_B[2]->array(mfi);
 
-            amrex::Real const * AMREX_RESTRICT sigma_fac_x = sigba[mfi].sigma_fac[0].data();
-#if defined(WARPX_DIM_3D)
-            amrex::Real const * AMREX_RESTRICT sigma_fac_y = sigba[mfi].sigma_fac[1].data();
-            amrex::Real const * AMREX_RESTRICT sigma_fac_z = sigba[mfi].sigma_fac[2].data();
-#else
-            amrex::Real const * AMREX_RESTRICT sigma_fac_y = nullptr;
-            amrex::Real const * AMREX_RESTRICT sigma_fac_z = sigba[mfi].sigma_fac[1].data();
-#endif
-            amrex::Real const * AMREX_RESTRICT sigma_star_fac_x = sigba[mfi].sigma_star_fac[0].data();
-#if defined(WARPX_DIM_3D)
-            amrex::Real const * AMREX_RESTRICT sigma_star_fac_y = sigba[mfi].sigma_star_fac[1].data();
-            amrex::Real const * AMREX_RESTRICT sigma_star_fac_z = sigba[mfi].sigma_star_fac[2].data();
-#else
-            amrex::Real const * AMREX_RESTRICT sigma_star_fac_y = nullptr;
-            amrex::Real const * AMREX_RESTRICT sigma_star_fac_z = sigba[mfi].sigma_star_fac[1].data();
-#endif
-            int const x_lo = sigba[mfi].sigma_fac[0].lo();
-#if defined(WARPX_DIM_3D)
-            int const y_lo = sigba[mfi].sigma_fac[1].lo();
-            int const z_lo = sigba[mfi].sigma_fac[2].lo();
-#else
-            int const y_lo = 0;
-            int const z_lo = sigba[mfi].sigma_fac[1].lo();
-#endif
+            // Null along the directions where this box is not damped
+            const PMLDampingFactors damping = sigba[mfi].GetDampingFactors();
+            amrex::Real const * AMREX_RESTRICT sigma_fac_x = damping.sigma_fac_x;
+            amrex::Real const * AMREX_RESTRICT sigma_fac_y = damping.sigma_fac_y;
+            amrex::Real const * AMREX_RESTRICT sigma_fac_z = damping.sigma_fac_z;
+            amrex::Real const * AMREX_RESTRICT sigma_star_fac_x = damping.sigma_star_fac_x;
+            amrex::Real const * AMREX_RESTRICT sigma_star_fac_y = damping.sigma_star_fac_y;
+            amrex::Real const * AMREX_RESTRICT sigma_star_fac_z = damping.sigma_star_fac_z;
+            int const x_lo = damping.x_lo;
+            int const y_lo = damping.y_lo;
+            int const z_lo = damping.z_lo;
 
             amrex::ParallelFor(tex, tey, tez,
             [=] AMREX_GPU_DEVICE (int i, int j, int k) {
@@ -180,25 +167,28 @@ WarpX::DampPML_Cartesian (const int lev, PatchType patch_type)
                                   dive_cleaning);
             });
 
-            amrex::ParallelFor(tbx, tby, tbz,
-            [=] AMREX_GPU_DEVICE (int i, int j, int k) {
+            // B may have been damped already, at the end of its last update (see EvolveBPML)
+            if (damp_B) {
+                amrex::ParallelFor(tbx, tby, tbz,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) {
 
-                warpx_damp_pml_bx(i, j, k, pml_Bxfab, Bx_stag, sigma_fac_x, sigma_fac_y, sigma_fac_z,
-                                  sigma_star_fac_x, sigma_star_fac_y, sigma_star_fac_z, x_lo, y_lo, z_lo,
-                                  divb_cleaning);
-            },
-            [=] AMREX_GPU_DEVICE (int i, int j, int k) {
+                    warpx_damp_pml_bx(i, j, k, pml_Bxfab, Bx_stag, sigma_fac_x, sigma_fac_y, sigma_fac_z,
+                                      sigma_star_fac_x, sigma_star_fac_y, sigma_star_fac_z, x_lo, y_lo, z_lo,
+                                      divb_cleaning);
+                },
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) {
 
-                warpx_damp_pml_by(i, j, k, pml_Byfab, By_stag, sigma_fac_x, sigma_fac_y, sigma_fac_z,
-                                  sigma_star_fac_x, sigma_star_fac_y, sigma_star_fac_z, x_lo, y_lo, z_lo,
-                                  divb_cleaning);
-            },
-            [=] AMREX_GPU_DEVICE (int i, int j, int k) {
+                    warpx_damp_pml_by(i, j, k, pml_Byfab, By_stag, sigma_fac_x, sigma_fac_y, sigma_fac_z,
+                                      sigma_star_fac_x, sigma_star_fac_y, sigma_star_fac_z, x_lo, y_lo, z_lo,
+                                      divb_cleaning);
+                },
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) {
 
-                warpx_damp_pml_bz(i, j, k, pml_Bzfab, Bz_stag, sigma_fac_x, sigma_fac_y, sigma_fac_z,
-                                  sigma_star_fac_x, sigma_star_fac_y, sigma_star_fac_z, x_lo, y_lo, z_lo,
-                                  divb_cleaning);
-            });
+                    warpx_damp_pml_bz(i, j, k, pml_Bzfab, Bz_stag, sigma_fac_x, sigma_fac_y, sigma_fac_z,
+                                      sigma_star_fac_x, sigma_star_fac_y, sigma_star_fac_z, x_lo, y_lo, z_lo,
+                                      divb_cleaning);
+                });
+            }
 
             // For warpx_damp_pml_F(), mfi.nodaltilebox is used in the ParallelFor loop and here we
             // use mfi.tilebox. However, it does not matter because in damp_pml, where nodaltilebox
@@ -252,6 +242,8 @@ WarpX::DampJPML (int lev, PatchType patch_type)
 {
     if (!do_pml) { return; }
     if (!do_pml_j_damping) { return; }
+    // Without particles in the PML, the current in the PML is zero (and not allocated)
+    if (!pml_has_particles) { return; }
     if (!pml[lev]) { return; }
 
     WARPX_PROFILE("WarpX::DampJPML()");
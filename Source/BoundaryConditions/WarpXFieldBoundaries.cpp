@@ -53,6 +53,16 @@ void WarpX::ApplyEfieldBoundary(const int lev, PatchType patch_type, amrex::Real
 {
     using ablastr::fields::Direction;
 
+    if (::isAnyBoundary<FieldBoundaryType::CPML>(field_boundary_lo, field_boundary_hi)
+        && patch_type == PatchType::fine) {
+        // the CPML layers are terminated by a perfect conductor
+        PEC::ApplyPECtoEfield(
+                m_fields.get_alldirs(FieldType::Efield_fp, lev),
+                field_boundary_lo, field_boundary_hi, FieldBoundaryType::CPML,
+                get_ng_fieldgather(), Geom(lev),
+                lev, patch_type, ref_ratio);
+    }
+
     if (::isAnyBoundary<FieldBoundaryType::PEC>(field_boundary_lo, field_boundary_hi)) {
         if (patch_type == PatchType::fine) {
             PEC::ApplyPECtoEfield(
@@ -182,6 +192,16 @@ void WarpX::ApplyBfieldBoundary (const int lev, PatchType patch_type, DtType a_d
 {
     using ablastr::fields::Direction;
 
+    if (::isAnyBoundary<FieldBoundaryType::CPML>(field_boundary_lo, field_boundary_hi)
+        && patch_type == PatchType::fine) {
+        // the CPML layers are terminated by a perfect conductor
+        PEC::ApplyPECtoBfield(
+                m_fields.get_alldirs(FieldType::Bfield_fp, lev),
+                field_boundary_lo, field_boundary_hi, FieldBoundaryType::CPML,
+                get_ng_fieldgather(), Geom(lev),
+                lev, patch_type, ref_ratio);
+    }
+
     if (::isAnyBoundary<FieldBoundaryType::PEC>(field_boundary_lo, field_boundary_hi)) {
         if (patch_type == PatchType::fine) {
             PEC::ApplyPECtoBfield(
@@ -1,5 +1,6 @@
 #include "FlushFormatCheckpoint.H"
 
+#include "BoundaryConditions/CPML.H"
 #include "BoundaryConditions/PML.H"
 #if (defined WARPX_DIM_RZ) && (defined WARPX_USE_FFT)
 #   include "BoundaryConditions/PML_RZ.H"
@@ -7,6 +8,7 @@
 #include "Diagnostics/ParticleDiag/ParticleDiag.H"
 #include "Diagnostics/ReducedDiags/MultiReducedDiags.H"
 #include "Fields.H"
+#include "Particles/MultiParticleContainer.H"
 #include "Particles/WarpXParticleContainer.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXProfilerWrapper.H"
@@ -112,6 +114,22 @@ FlushFormatCheckpoint::WriteToFile (
                          amrex::MultiFabFileFullPrefix(lev, checkpointname, default_level_prefix, "jz_fp"));
         }
 
+        // Super-cycled species add their current, deposited at their last push, at every step
+        const auto species_names = warpx.GetPartContainer().GetSpeciesNames();
+        for (int i = 0; i < static_cast<int>(species_names.size()); ++i) {
+            const std::string current_species_string =
+                WarpXParticleContainer::MultiRateCurrentName(species_names[i]);
+            if (warpx.GetPartContainer().GetParticleContainer(i).getPushInterval() > 1 &&
+                warpx.m_fields.has_vector(current_species_string, lev)) {
+                VisMF::Write(*warpx.m_fields.get(current_species_string, Direction{0}, lev),
+                             amrex::MultiFabFileFullPrefix(lev, checkpointname, default_level_prefix, "jx_fp_" + species_names[i]));
+                VisMF::Write(*warpx.m_fields.get(current_species_string, Direction{1}, lev),
+                             amrex::MultiFabFileFullPrefix(lev, checkpointname, default_level_prefix, "jy_fp_" + species_names[i]));
+                VisMF::Write(*warpx.m_fields.get(current_species_string, Direction{2}, lev),
+                             amrex::MultiFabFileFullPrefix(lev, checkpointname, default_level_prefix, "jz_fp_" + species_names[i]));
+            }
+        }
+
         if (lev > 0)
         {
             VisMF::Write(*warpx.m_fields.get(FieldType::Efield_cp, Direction{0}, lev),
@@ -169,6 +187,11 @@ FlushFormatCheckpoint::WriteToFile (
             }
 #endif
         }
+
+        if (lev == 0 && warpx.GetCPML()) {
+            warpx.GetCPML()->CheckPoint(
+                amrex::MultiFabFileFullPrefix(lev, checkpointname, default_level_prefix, "cpml"));
+        }
     }
 
     CheckpointParticles(checkpointname, particle_diags);
@@ -0,0 +1,87 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "CallbackTiming.H"
+
+#include "Diagnostics/ReducedDiags/ReducedDiags.H"
+#include "Python/callbacks.H"
+
+#include <AMReX_Enum.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+
+using namespace amrex::literals;
+
+// constructor
+CallbackTiming::CallbackTiming (const std::string& rd_name)
+: ReducedDiags{rd_name}
+{
+    const auto location_names = amrex::getEnumNameStrings<PythonCallbackLocation>();
+    const auto num_locations = static_cast<int>(location_names.size());
+
+    // time spent in each location, and in all of them
+    m_data.resize(num_locations + 1, 0.0_rt);
+    m_previous_time.resize(num_locations, 0.);
+
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        if ( m_write_header )
+        {
+            // open file
+            std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+            // write header row
+            int c = 0;
+            ofs << "#";
+            ofs << "[" << c++ << "]step()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]time(s)";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]total(s)";
+            for (const auto& name : location_names) {
+                ofs << m_sep;
+                ofs << "[" << c++ << "]" << name << "(s)";
+            }
+            ofs << "\n";
+            // close file
+            ofs.close();
+        }
+    }
+}
+// end constructor
+
+// function that computes the time spent in the Python callbacks
+void CallbackTiming::ComputeDiags (int step)
+{
+    // Judge if the diags should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    // The built-in locations are the first slots
+    const auto& slots = GetPythonCallbackSlots();
+    const auto num_locations = static_cast<int>(m_previous_time.size());
+
+    std::vector<amrex::Real> times(num_locations);
+    for (int i = 0; i < num_locations; ++i) {
+        times[i] = static_cast<amrex::Real>(slots[i].time - m_previous_time[i]);
+        m_previous_time[i] = slots[i].time;
+    }
+
+    // the slowest MPI rank determines the time spent in the callbacks
+    amrex::ParallelDescriptor::ReduceRealMax(times.data(), num_locations);
+
+    m_data[0] = 0.0_rt;
+    for (int i = 0; i < num_locations; ++i) {
+        m_data[i+1] = times[i];
+        m_data[0] += times[i];
+    }
+
+    /* m_data now contains up-to-date values for:
+     *  [total time spent in the callbacks since the previous output,
+     *   time spent in the callbacks of each location since the previous output] */
+}
+// end void CallbackTiming::ComputeDiags
@@ -0,0 +1,107 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "ImplicitSolverIterations.H"
+
+#include "Diagnostics/ReducedDiags/ReducedDiags.H"
+#include "FieldSolver/ImplicitSolvers/ImplicitSolver.H"
+#include "Utils/TextMsg.H"
+#include "WarpX.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+#include <string>
+
+using namespace amrex::literals;
+
+// constructor
+ImplicitSolverIterations::ImplicitSolverIterations (const std::string& rd_name)
+: ReducedDiags{rd_name}
+{
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        WarpX::GetInstance().GetImplicitSolver() != nullptr,
+        "The ImplicitSolverIterations reduced diagnostic requires an implicit evolve scheme");
+
+    // nonlinear and linear iterations at the last step, and on average per step,
+    // and reuse rate of the approximate Jacobian
+    m_data.resize(5, 0.0_rt);
+
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        if ( m_write_header )
+        {
+            // open file
+            std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+            // write header row
+            int c = 0;
+            ofs << "#";
+            ofs << "[" << c++ << "]step()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]time(s)";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]nonlinear_iterations()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]linear_iterations()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]nonlinear_iterations_per_step()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]linear_iterations_per_step()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]jacobian_reuse_rate()";
+            ofs << "\n";
+            // close file
+            ofs.close();
+        }
+    }
+}
+// end constructor
+
+// function that gets the number of iterations of the implicit solver
+void ImplicitSolverIterations::ComputeDiags (int step)
+{
+    const ImplicitSolver* solver = WarpX::GetInstance().GetImplicitSolver();
+
+    // accumulate the iterations of every step, also between two outputs
+    // (nothing to accumulate before the first step)
+    const int num_solves = solver->NumSolves();
+    if (num_solves == m_num_solves) { return; }
+    m_num_solves = num_solves;
+    const int nonlinear_iterations = solver->NumNonlinearIterations();
+    const int linear_iterations = solver->NumLinearIterations();
+    ++m_num_steps;
+    m_num_nonlinear_iterations += nonlinear_iterations;
+    m_num_linear_iterations += linear_iterations;
+    m_num_jacobian_refreshes += solver->NumJacobianRefreshes();
+    m_num_jacobian_reuses += solver->NumJacobianReuses();
+
+    // Judge if the diags should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    const auto num_steps = static_cast<amrex::Real>(m_num_steps);
+    m_data[0] = static_cast<amrex::Real>(nonlinear_iterations);
+    m_data[1] = static_cast<amrex::Real>(linear_iterations);
+    m_data[2] = static_cast<amrex::Real>(m_num_nonlinear_iterations) / num_steps;
+    m_data[3] = static_cast<amrex::Real>(m_num_linear_iterations) / num_steps;
+    const long num_jacobian_updates = m_num_jacobian_refreshes + m_num_jacobian_reuses;
+    m_data[4] = (num_jacobian_updates > 0) ?
+        static_cast<amrex::Real>(m_num_jacobian_reuses) / static_cast<amrex::Real>(num_jacobian_updates) : 0.0_rt;
+
+    m_num_steps = 0;
+    m_num_nonlinear_iterations = 0;
+    m_num_linear_iterations = 0;
+    m_num_jacobian_refreshes = 0;
+    m_num_jacobian_reuses = 0;
+
+    /* m_data now contains up-to-date values for:
+     *  [nonlinear and linear iterations of the last step,
+     *   average nonlinear and linear iterations per step since the previous output,
+     *   fraction of the Newton iterations since the previous output that reused
+     *   the approximate particle response of the Jacobian] */
+}
+// end void ImplicitSolverIterations::ComputeDiags
@@ -0,0 +1,98 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "ParticleMemory.H"
+
+#include "Diagnostics/ReducedDiags/ReducedDiags.H"
+#include "Particles/MultiParticleContainer.H"
+#include "Particles/ParticleTilePool.H"
+#include "WarpX.H"
+
+#include <AMReX_INT.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_REAL.H>
+
+#include <array>
+#include <fstream>
+
+using namespace amrex::literals;
+
+namespace
+{
+    // Number of quantities written by this diagnostic
+    constexpr int num_quantities = 8;
+}
+
+// constructor
+ParticleMemory::ParticleMemory (const std::string& rd_name)
+: ReducedDiags{rd_name}
+{
+    m_data.resize(num_quantities, 0.0_rt);
+
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        if ( m_write_header )
+        {
+            // open file
+            std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+            // write header row
+            int c = 0;
+            ofs << "#";
+            ofs << "[" << c++ << "]step()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]time(s)";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]num_tiles()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]num_particles()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]capacity()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]used(B)";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]reserved(B)";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]num_grow()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]num_shrink()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]num_realloc()";
+            ofs << "\n";
+            // close file
+            ofs.close();
+        }
+    }
+}
+// end constructor
+
+// function that computes the memory statistics of the particle tiles
+void ParticleMemory::ComputeDiags (int step)
+{
+    // Judge if the diags should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    const auto & mypc = WarpX::GetInstance().GetPartContainer();
+    const auto stats = mypc.GetTilePoolStats();
+
+    auto values = std::array<amrex::Long, num_quantities>{
+        stats.num_tiles, stats.num_particles, stats.capacity,
+        stats.bytes_used, stats.bytes_reserved,
+        stats.num_grow, stats.num_shrink, stats.num_realloc};
+
+    // sum over all MPI ranks
+    amrex::ParallelDescriptor::ReduceLongSum(values.data(), num_quantities);
+
+    for (int i = 0; i < num_quantities; ++i) {
+        m_data[i] = static_cast<amrex::Real>(values[i]);
+    }
+
+    /* m_data now contains up-to-date values for:
+     *  [number of tiles, number of particles, capacity of the tiles (in particles),
+     *   bytes used, bytes reserved, number of tiles grown by the pool,
+     *   number of tiles shrunk by the pool, number of reallocations during Redistribute] */
+}
+// end void ParticleMemory::ComputeDiags
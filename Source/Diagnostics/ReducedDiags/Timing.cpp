@@ -0,0 +1,103 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "Timing.H"
+
+#include "Diagnostics/ReducedDiags/ReducedDiags.H"
+#include "Evolve/WarpXTimingRegion.H"
+#include "WarpX.H"
+
+#include <ablastr/utils/timer/RegionTimers.H>
+
+#include <AMReX_Enum.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace amrex::literals;
+
+// constructor
+Timing::Timing (const std::string& rd_name)
+: ReducedDiags{rd_name}
+{
+    const auto region_names = amrex::getEnumNameStrings<TimingRegion>();
+    const auto num_regions = static_cast<int>(region_names.size());
+
+    // minimum, average and maximum over the MPI ranks of the time spent
+    // in all the phases, and in each phase
+    m_data.resize(3*(num_regions + 1), 0.0_rt);
+    m_previous_time.resize(num_regions, 0.);
+
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        if ( m_write_header )
+        {
+            // open file
+            std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+            // write header row
+            int c = 0;
+            ofs << "#";
+            ofs << "[" << c++ << "]step()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]time(s)";
+            std::vector<std::string> column_names{"total"};
+            column_names.insert(column_names.end(), region_names.begin(), region_names.end());
+            for (const auto& name : column_names) {
+                for (const auto* reduction : {"_min", "_avg", "_max"}) {
+                    ofs << m_sep;
+                    ofs << "[" << c++ << "]" << name << reduction << "(s)";
+                }
+            }
+            ofs << "\n";
+            // close file
+            ofs.close();
+        }
+    }
+}
+// end constructor
+
+// function that computes the time spent in each phase of the PIC step
+void Timing::ComputeDiags (int step)
+{
+    // Judge if the diags should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    const auto& durations = WarpX::GetInstance().GetRegionTimers().get_durations();
+    const auto num_regions = static_cast<int>(m_previous_time.size());
+
+    // time spent on this MPI rank in all the phases, and in each phase
+    std::vector<amrex::Real> times(num_regions + 1, 0.0_rt);
+    for (int i = 0; i < num_regions; ++i) {
+        times[i+1] = static_cast<amrex::Real>(durations[i] - m_previous_time[i]);
+        times[0] += times[i+1];
+        m_previous_time[i] = durations[i];
+    }
+
+    std::vector<amrex::Real> times_min = times;
+    std::vector<amrex::Real> times_avg = times;
+    std::vector<amrex::Real> times_max = times;
+    const int ntimes = num_regions + 1;
+    amrex::ParallelDescriptor::ReduceRealMin(times_min.data(), ntimes);
+    amrex::ParallelDescriptor::ReduceRealSum(times_avg.data(), ntimes);
+    amrex::ParallelDescriptor::ReduceRealMax(times_max.data(), ntimes);
+
+    const auto nprocs = static_cast<amrex::Real>(amrex::ParallelDescriptor::NProcs());
+    for (int i = 0; i < ntimes; ++i) {
+        m_data[3*i  ] = times_min[i];
+        m_data[3*i+1] = times_avg[i]/nprocs;
+        m_data[3*i+2] = times_max[i];
+    }
+
+    /* m_data now contains up-to-date values for:
+     *  [min, avg and max over the MPI ranks of the total time spent in the PIC steps
+     *   since the previous output,
+     *   min, avg and max of the time spent in each phase since the previous output] */
+}
+// end void Timing::ComputeDiags
@@ -7,6 +7,7 @@
  *
  * License: BSD-3-Clause-LBNL
  */
+#include "BoundaryConditions/CPML.H"
 #include "BoundaryConditions/PML.H"
 #if (defined WARPX_DIM_RZ) && (defined WARPX_USE_FFT)
 #    include "BoundaryConditions/PML_RZ.H"
@@ -340,6 +341,27 @@ WarpX::InitFromCheckpoint ()
                         amrex::MultiFabFileFullPrefix(lev, restart_chkfile, level_prefix, "jz_fp"));
         }
 
+        // Current of the super-cycled species, deposited at their last push
+        const auto species_names = mypc->GetSpeciesNames();
+        for (int i = 0; i < static_cast<int>(species_names.size()); ++i) {
+            const std::string jx_name = amrex::MultiFabFileFullPrefix(
+                lev, restart_chkfile, level_prefix, "jx_fp_" + species_names[i]);
+            if (mypc->GetParticleContainer(i).getPushInterval() == 1 || !VisMF::Exist(jx_name)) { continue; }
+
+            const std::string current_species_string =
+                WarpXParticleContainer::MultiRateCurrentName(species_names[i]);
+            for (int idir = 0; idir < 3; ++idir) {
+                const amrex::MultiFab& J = *m_fields.get(FieldType::current_fp, Direction{idir}, lev);
+                m_fields.alloc_init(current_species_string, Direction{idir}, lev,
+                                    J.boxArray(), J.DistributionMap(), J.nComp(), J.nGrowVect(), 0.0);
+            }
+            VisMF::Read(*m_fields.get(current_species_string, Direction{0}, lev), jx_name);
+            VisMF::Read(*m_fields.get(current_species_string, Direction{1}, lev),
+                        amrex::MultiFabFileFullPrefix(lev, restart_chkfile, level_prefix, "jy_fp_" + species_names[i]));
+            VisMF::Read(*m_fields.get(current_species_string, Direction{2}, lev),
+                        amrex::MultiFabFileFullPrefix(lev, restart_chkfile, level_prefix, "jz_fp_" + species_names[i]));
+        }
+
         if (lev > 0)
         {
             VisMF::Read(*m_fields.get(FieldType::Efield_cp, Direction{0}, lev),
@@ -399,6 +421,11 @@ WarpX::InitFromCheckpoint ()
         }
     }
 
+    InitCPML();
+    if (m_cpml) {
+        m_cpml->Restart(amrex::MultiFabFileFullPrefix(0, restart_chkfile, level_prefix, "cpml"));
+    }
+
     if (EB::enabled()) { InitializeEBGridData(maxLevel()); }
 
     reduced_diags->ReadCheckpointData(restart_chkfile);
@@ -129,18 +129,21 @@ WarpX::Evolve (int numsteps)
     for (int step = istep[0]; step < numsteps_max && cur_time < stop_time; ++step)
     {
         WARPX_PROFILE("WarpX::Evolve::step");
+        // The time of the step that is not spent in the other phases is attributed to "other"
+        const auto step_timing = TimeRegion(TimingRegion::other);
         const auto evolve_time_beg_step = static_cast<Real>(amrex::second());
 
         // Check and clear signal flags and asynchronously broadcast them from process 0
         SignalHandling::CheckSignals();
 
         multi_diags->NewIteration();
+        SetPythonCallbackStep(step+1);
 
         // Start loop on time steps
         if (verbose) {
             amrex::Print() << "STEP " << step+1 << " starts ...\n";
         }
-        ExecutePythonCallback("beforestep");
+        ExecutePythonCallback(PythonCallbackLocation::beforestep);
 
         CheckLoadBalance(step);
 
@@ -173,19 +176,25 @@ WarpX::Evolve (int numsteps)
         // ionization, Coulomb collisions, QED
         doFieldIonization();
 
-        ExecutePythonCallback("beforecollisions");
-        mypc->doCollisions( cur_time, dt[0] );
-        ExecutePythonCallback("aftercollisions");
+        ExecutePythonCallback(PythonCallbackLocation::beforecollisions);
+        {
+            const auto timing = TimeRegion(TimingRegion::collisions);
+            mypc->doCollisions( cur_time, dt[0] );
+        }
+        ExecutePythonCallback(PythonCallbackLocation::aftercollisions);
 
 #ifdef WARPX_QED
-        doQEDEvents();
-        mypc->doQEDSchwinger();
+        {
+            const auto timing = TimeRegion(TimingRegion::collisions);
+            doQEDEvents();
+            mypc->doQEDSchwinger();
+        }
 #endif
 
         // Main PIC operation:
         // gather fields, push particles, deposit sources, update fields
 
-        ExecutePythonCallback("particleinjection");
+        ExecutePythonCallback(PythonCallbackLocation::particleinjection);
 
         if (m_implicit_solver) {
             m_implicit_solver->OneStep(cur_time, dt[0], step);
@@ -255,7 +264,10 @@ WarpX::Evolve (int numsteps)
             t_old[i] = t_new[i];
             t_new[i] = cur_time;
         }
-        multi_diags->FilterComputePackFlush( step, false, true );
+        {
+            const auto timing = TimeRegion(TimingRegion::diagnostics);
+            multi_diags->FilterComputePackFlush( step, false, true );
+        }
 
         const bool move_j = is_synchronized;
         // If is_synchronized we need to shift j too so that next step we can evolve E by dt/2.
@@ -276,7 +288,7 @@ WarpX::Evolve (int numsteps)
         if( electrostatic_solver_id != ElectrostaticSolverAlgo::None ||
             electromagnetic_solver_id == ElectromagneticSolverAlgo::HybridPIC )
         {
-            ExecutePythonCallback("beforeEsolve");
+            ExecutePythonCallback(PythonCallbackLocation::beforeEsolve);
 
             if (electrostatic_solver_id != ElectrostaticSolverAlgo::None) {
                 // Electrostatic solver:
@@ -306,24 +318,28 @@ WarpX::Evolve (int numsteps)
                 // and Ampere's law).
                 HybridPICEvolveFields();
             }
-            ExecutePythonCallback("afterEsolve");
+            ExecutePythonCallback(PythonCallbackLocation::afterEsolve);
         }
 
         // afterstep callback runs with the updated global time. It is included
         // in the evolve timing.
-        ExecutePythonCallback("afterstep");
+        ExecutePythonCallback(PythonCallbackLocation::afterstep);
 
-        /// reduced diags
-        if (reduced_diags->m_plot_rd != 0)
         {
-            reduced_diags->LoadBalance();
-            reduced_diags->ComputeDiags(step);
-            reduced_diags->WriteToFile(step);
+            const auto timing = TimeRegion(TimingRegion::diagnostics);
+
+            /// reduced diags
+            if (reduced_diags->m_plot_rd != 0)
+            {
+                reduced_diags->LoadBalance();
+                reduced_diags->ComputeDiags(step);
+                reduced_diags->WriteToFile(step);
+            }
+            multi_diags->FilterComputePackFlush( step );
         }
-        multi_diags->FilterComputePackFlush( step );
 
         // execute afterdiagnostic callbacks
-        ExecutePythonCallback("afterdiagnostics");
+        ExecutePythonCallback(PythonCallbackLocation::afterdiagnostics);
 
         // inputs: unused parameters (e.g. typos) check after step 1 has finished
         if (!early_params_checked) {
@@ -356,7 +372,7 @@ WarpX::Evolve (int numsteps)
     if (istep[0] == max_step || (stop_time - 1.e-3*dt[0] <= cur_time && cur_time < stop_time + dt[0])
         || m_exit_loop_due_to_interrupt_signal) {
         multi_diags->FilterComputePackFlushLastTimestep( istep[0] );
-        if (m_exit_loop_due_to_interrupt_signal) { ExecutePythonCallback("onbreaksignal"); }
+        if (m_exit_loop_due_to_interrupt_signal) { ExecutePythonCallback(PythonCallbackLocation::onbreaksignal); }
     }
 
     amrex::Print() <<
@@ -377,12 +393,12 @@ WarpX::OneStep_nosub (Real cur_time)
     // Deposit current j^{n+1/2}
     // Deposit charge density rho^{n}
 
-    ExecutePythonCallback("particlescraper");
-    ExecutePythonCallback("beforedeposition");
+    ExecutePythonCallback(PythonCallbackLocation::particlescraper);
+    ExecutePythonCallback(PythonCallbackLocation::beforedeposition);
 
     PushParticlesandDeposit(cur_time);
 
-    ExecutePythonCallback("afterdeposition");
+    ExecutePythonCallback(PythonCallbackLocation::afterdeposition);
 
     // Synchronize J and rho:
     // filter (if used), exchange guard cells, interpolate across MR levels
@@ -397,7 +413,7 @@ WarpX::OneStep_nosub (Real cur_time)
     if (do_pml && pml_has_particles) { CopyJPML(); }
     if (do_pml && do_pml_j_damping) { DampJPML(); }
 
-    ExecutePythonCallback("beforeEsolve");
+    ExecutePythonCallback(PythonCallbackLocation::beforeEsolve);
 
     // Push E and B from {n} to {n+1}
     // (And update guard cells immediately afterwards)
@@ -429,6 +445,17 @@ WarpX::OneStep_nosub (Real cur_time)
                 FillBoundaryG(guard_cells.ng_alloc_G, WarpX::sync_nodal_points);
             }
         }
+    } else if (fdtd_temporal_blocking &&
+               !IsPythonCallbackInstalled(PythonCallbackLocation::afterBpush) &&
+               !IsPythonCallbackInstalled(PythonCallbackLocation::afterEpush)) {
+        // Same updates as below (B by dt/2, E by dt, B by dt/2), done block by block
+        EvolveEBTemporallyBlocked(dt[0]); // We now have E^{n+1} and B^{n+1}
+        FillBoundaryE(guard_cells.ng_FieldSolver, WarpX::sync_nodal_points);
+
+        // B: guard cells are NOT up-to-date
+        if (m_safe_guard_cells) {
+            FillBoundaryB(guard_cells.ng_alloc_EB);
+        }
     } else {
         EvolveF(0.5_rt * dt[0], DtType::FirstHalf);
         EvolveG(0.5_rt * dt[0], DtType::FirstHalf);
@@ -451,10 +478,13 @@ WarpX::OneStep_nosub (Real cur_time)
 
         EvolveF(0.5_rt * dt[0], DtType::SecondHalf);
         EvolveG(0.5_rt * dt[0], DtType::SecondHalf);
-        EvolveB(0.5_rt * dt[0], DtType::SecondHalf, cur_time + 0.5_rt * dt[0]); // We now have B^{n+1}
+        // The PML damping of B is done in the same pass as its last update,
+        // unless a Python callback may read B in between
+        const bool damp_pml_B = do_pml && !IsPythonCallbackInstalled(PythonCallbackLocation::afterBpush);
+        EvolveB(0.5_rt * dt[0], DtType::SecondHalf, cur_time + 0.5_rt * dt[0], damp_pml_B); // We now have B^{n+1}
 
         if (do_pml) {
-            DampPML();
+            DampPML(!damp_pml_B);
             FillBoundaryE(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
             FillBoundaryB(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
             FillBoundaryF(guard_cells.ng_MovingWindow, WarpX::sync_nodal_points);
@@ -468,7 +498,7 @@ WarpX::OneStep_nosub (Real cur_time)
         }
     } // !PSATD
 
-    ExecutePythonCallback("afterEsolve");
+    ExecutePythonCallback(PythonCallbackLocation::afterEsolve);
 }
 
 bool WarpX::checkStopSimulation (amrex::Real cur_time)
@@ -540,6 +570,8 @@ void WarpX::ExplicitFillBoundaryEBUpdateAux ()
 
 void WarpX::HandleParticlesAtBoundaries (int step, amrex::Real cur_time, int num_moved)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     mypc->ContinuousFluxInjection(cur_time, dt[0]);
 
     mypc->ApplyBoundaryConditions();
@@ -549,7 +581,13 @@ void WarpX::HandleParticlesAtBoundaries (int step, amrex::Real cur_time, int num
     if( electromagnetic_solver_id == ElectromagneticSolverAlgo::None ||
         electromagnetic_solver_id == ElectromagneticSolverAlgo::HybridPIC )
     {
-        mypc->Redistribute();
+        // In practice, most particles still move by less than a few cells:
+        // use a neighbor-only Redistribute when possible
+        if (max_level == 0 && mypc->RedistributeNeighborHalo() > 0) {
+            mypc->RedistributeNeighborOrGlobal(mypc->RedistributeNeighborHalo() + num_moved);
+        } else {
+            mypc->Redistribute();
+        }
     }
     else
     {
@@ -564,7 +602,13 @@ void WarpX::HandleParticlesAtBoundaries (int step, amrex::Real cur_time, int num
                 // Standard algorithm ; particles can move by up to 1 cell
                 num_redistribute_ghost += 1;
             }
-            mypc->RedistributeLocal(num_redistribute_ghost);
+            if (mypc->hasSuperCycledSpecies()) {
+                // Super-cycled species are pushed with a larger time step,
+                // and may thus move by more cells
+                mypc->RedistributeNeighborOrGlobal(num_redistribute_ghost);
+            } else {
+                mypc->RedistributeLocal(num_redistribute_ghost);
+            }
         }
         else {
             mypc->Redistribute();
@@ -590,6 +634,8 @@ void WarpX::HandleParticlesAtBoundaries (int step, amrex::Real cur_time, int num
 
 void WarpX::SyncCurrentAndRho ()
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     using ablastr::fields::Direction;
     using warpx::fields::FieldType;
 
@@ -1085,6 +1131,8 @@ WarpX::doFieldIonization ()
 void
 WarpX::doFieldIonization (int lev)
 {
+    const auto timing = TimeRegion(TimingRegion::collisions);
+
     using ablastr::fields::Direction;
     using warpx::fields::FieldType;
 
@@ -1140,6 +1188,8 @@ void
 WarpX::PushParticlesandDeposit (int lev, amrex::Real cur_time, DtType a_dt_type, bool skip_current,
                                PushType push_type)
 {
+    const auto timing = TimeRegion(TimingRegion::particles);
+
     using ablastr::fields::Direction;
     using warpx::fields::FieldType;
 
@@ -1283,6 +1333,6 @@ WarpX::HandleSignals()
 
     if (SignalHandling::TestAndResetActionRequestFlag(SignalHandling::SIGNAL_REQUESTS_CHECKPOINT)) {
         multi_diags->FilterComputePackFlushLastTimestep( istep[0] );
-        ExecutePythonCallback("oncheckpointsignal");
+        ExecutePythonCallback(PythonCallbackLocation::oncheckpointsignal);
     }
 }
@@ -40,6 +40,14 @@ void ElectrostaticSolver::ReadParameters () {
         pp_warpx, "self_fields_max_iters", self_fields_max_iters);
    utils::parser::queryWithParser(
         pp_warpx, "self_fields_verbosity", self_fields_verbosity);
+    pp_warpx.query("self_fields_reuse_solver", self_fields_reuse_solver);
+    pp_warpx.query("self_fields_extrapolate_initial_guess", self_fields_extrapolate_initial_guess);
+    utils::parser::queryWithParser(
+        pp_warpx, "self_fields_noise_tolerance_factor", self_fields_noise_tolerance_factor);
+    if (self_fields_reuse_solver || self_fields_extrapolate_initial_guess) {
+        m_poisson_solver_cache = std::make_unique<ablastr::fields::PoissonSolverCache>();
+        m_poisson_solver_cache->extrapolate_initial_guess = self_fields_extrapolate_initial_guess;
+    }
 
     // FFT solver flags
    utils::parser::queryWithParser(
@@ -127,7 +135,8 @@ ElectrostaticSolver::computePhi (
     Real absolute_tolerance,
     int const max_iters,
     int const verbosity,
-    bool const is_igf_2d
+    bool const is_igf_2d,
+    ablastr::fields::PoissonSolverCache* solver_cache
 ) const
 {
     using ablastr::fields::Direction;
@@ -216,7 +225,8 @@ ElectrostaticSolver::computePhi (
         post_phi_calculation,
         *m_poisson_boundary_handler,
         warpx.gett_new(0),
-        eb_farray_box_factory
+        eb_farray_box_factory,
+        solver_cache
     );
 
 }
@@ -14,8 +14,45 @@
 #include "Python/callbacks.H"
 #include "WarpX.H"
 
+#include <AMReX_MFIter.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+#include <AMReX_Reduce.H>
+
+#include <algorithm>
+#include <cmath>
+
 using namespace amrex;
 
+namespace
+{
+    /** \brief Count the points of the valid region of a MultiFab where its first component is not zero
+     *
+     * \param[in] mf the MultiFab
+     * \return the number of points, summed over all the MPI ranks
+     */
+    Long CountNonZero (MultiFab const& mf)
+    {
+        ReduceOps<ReduceOpSum> reduce_op;
+        ReduceData<Long> reduce_data(reduce_op);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            auto const arr = mf.const_array(mfi);
+            reduce_op.eval(mfi.tilebox(), reduce_data,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) -> GpuTuple<Long>
+                {
+                    return (arr(i,j,k) != 0._rt) ? Long(1) : Long(0);
+                });
+        }
+        Long num = get<0>(reduce_data.value());
+        ParallelDescriptor::ReduceLongSum(num);
+        return num;
+    }
+}
+
 void LabFrameExplicitES::InitData() {
     auto & warpx = WarpX::GetInstance();
     m_poisson_boundary_handler->DefinePhiBCs(warpx.Geom(0));
@@ -63,10 +100,10 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
     setPhiBC(phi_fp, warpx.gett_new(0));
 
     // Compute the potential phi, by solving the Poisson equation
-    if (IsPythonCallbackInstalled("poissonsolver")) {
+    if (IsPythonCallbackInstalled(PythonCallbackLocation::poissonsolver)) {
 
         // Use the Python level solver (user specified)
-        ExecutePythonCallback("poissonsolver");
+        ExecutePythonCallback(PythonCallbackLocation::poissonsolver);
 
     } else {
 
@@ -74,10 +111,30 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
         // Use the tridiag solver with 1D
         computePhiTriDiagonal(rho_fp, phi_fp);
 #else
+        // Relax the precision of the solve to the noise level of rho
+        Real required_precision = self_fields_required_precision;
+        if (self_fields_noise_tolerance_factor > 0._rt) {
+            Long num_particles = 0;
+            for (auto const& pc : mpc) { num_particles += pc->TotalNumberOfParticles(); }
+            // Only the points where there is charge are counted: the vacuum around
+            // a localized beam would otherwise overestimate the noise
+            Long const num_cells = CountNonZero(*rho_fp[0]);
+            if (num_particles > 0 && num_cells > 0) {
+                Real const noise = std::sqrt(static_cast<Real>(num_cells)/static_cast<Real>(num_particles));
+                required_precision = std::max(required_precision, self_fields_noise_tolerance_factor*noise);
+            }
+            if (self_fields_verbosity > 0) {
+                amrex::Print() << "Poisson solver: relative precision = " << required_precision
+                               << " (" << num_particles << " macroparticles in "
+                               << num_cells << " cells with charge)\n";
+            }
+        }
+
         // Use the AMREX MLMG or the FFT (IGF) solver otherwise
-        computePhi(rho_fp, phi_fp, beta, self_fields_required_precision,
+        computePhi(rho_fp, phi_fp, beta, required_precision,
                    self_fields_absolute_tolerance, self_fields_max_iters,
-                   self_fields_verbosity, is_igf_2d_slices);
+                   self_fields_verbosity, is_igf_2d_slices,
+                   m_poisson_solver_cache.get());
 #endif
 
     }
@@ -86,7 +143,7 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
     // field will be calculated in the computePhi call.
     if (!EB::enabled()) { computeE( Efield_fp, phi_fp, beta ); }
     else {
-        if (IsPythonCallbackInstalled("poissonsolver")) { computeE(Efield_fp, phi_fp, beta); }
+        if (IsPythonCallbackInstalled(PythonCallbackLocation::poissonsolver)) { computeE(Efield_fp, phi_fp, beta); }
     }
 }
 
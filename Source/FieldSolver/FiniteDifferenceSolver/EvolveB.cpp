@@ -12,6 +12,8 @@
 #   include "FiniteDifferenceAlgorithms/CartesianYeeAlgorithm.H"
 #   include "FiniteDifferenceAlgorithms/CartesianCKCAlgorithm.H"
 #   include "FiniteDifferenceAlgorithms/CartesianNodalAlgorithm.H"
+#   include "FiniteDifferenceAlgorithms/CartesianYeeLineKernels.H"
+#   include "FiniteDifferenceAlgorithms/StencilCoefficients.H"
 #else
 #   include "FiniteDifferenceAlgorithms/CylindricalYeeAlgorithm.H"
 #endif
@@ -42,6 +44,7 @@
 
 #include <array>
 #include <memory>
+#include <type_traits>
 
 using namespace amrex;
 
@@ -128,6 +131,11 @@ void FiniteDifferenceSolver::EvolveBCartesian (
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
+    // Stencil coefficients, passed by value to the kernels
+    auto const coefs = StencilCoefficients<T_Algo::n_coefs>::FromVectors(
+        m_h_stencil_coefs_x, m_h_stencil_coefs_y, m_h_stencil_coefs_z);
+    bool const use_line_kernels = std::is_same_v<T_Algo, CartesianYeeAlgorithm> && m_line_kernels;
+
     // Loop through the grids, and over the tiles within each grid
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -147,43 +155,44 @@ void FiniteDifferenceSolver::EvolveBCartesian (
         Array4<Real> const& Ey = Efield[1]->array(mfi);
         Array4<Real> const& Ez = Efield[2]->array(mfi);
 
-        // Extract stencil coefficients
-        Real const * const AMREX_RESTRICT coefs_x = m_stencil_coefs_x.dataPtr();
-        auto const n_coefs_x = static_cast<int>(m_stencil_coefs_x.size());
-        Real const * const AMREX_RESTRICT coefs_y = m_stencil_coefs_y.dataPtr();
-        auto const n_coefs_y = static_cast<int>(m_stencil_coefs_y.size());
-        Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
-        auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
-
         // Extract tileboxes for which to loop
         Box const& tbx  = mfi.tilebox(Bfield[0]->ixType().toIntVect());
         Box const& tby  = mfi.tilebox(Bfield[1]->ixType().toIntVect());
         Box const& tbz  = mfi.tilebox(Bfield[2]->ixType().toIntVect());
 
-        // Loop over the cells and update the fields
-        amrex::ParallelFor(tbx, tby, tbz,
+        if (use_line_kernels) {
 
-            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+            // Vectorized update on lines of cells (CPU only)
+            CartesianYeeLineKernels::EvolveB(tbx, tby, tbz, Bx, By, Bz, Ex, Ey, Ez,
+                coefs.x[0], coefs.y[0], coefs.z[0], dt);
 
-                Bx(i, j, k) += dt * T_Algo::UpwardDz(Ey, coefs_z, n_coefs_z, i, j, k)
-                             - dt * T_Algo::UpwardDy(Ez, coefs_y, n_coefs_y, i, j, k);
+        } else {
 
-            },
+            // Loop over the cells and update the fields
+            amrex::ParallelFor(tbx, tby, tbz,
 
-            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-                By(i, j, k) += dt * T_Algo::UpwardDx(Ez, coefs_x, n_coefs_x, i, j, k)
-                             - dt * T_Algo::UpwardDz(Ex, coefs_z, n_coefs_z, i, j, k);
+                    Bx(i, j, k) += dt * T_Algo::UpwardDz(Ey, coefs.z.data(), T_Algo::n_coefs, i, j, k)
+                                 - dt * T_Algo::UpwardDy(Ez, coefs.y.data(), T_Algo::n_coefs, i, j, k);
 
-            },
+                },
 
-            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-                Bz(i, j, k) += dt * T_Algo::UpwardDy(Ex, coefs_y, n_coefs_y, i, j, k)
-                             - dt * T_Algo::UpwardDx(Ey, coefs_x, n_coefs_x, i, j, k);
+                    By(i, j, k) += dt * T_Algo::UpwardDx(Ez, coefs.x.data(), T_Algo::n_coefs, i, j, k)
+                                 - dt * T_Algo::UpwardDz(Ex, coefs.z.data(), T_Algo::n_coefs, i, j, k);
 
-            }
-        );
+                },
+
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
+
+                    Bz(i, j, k) += dt * T_Algo::UpwardDy(Ex, coefs.y.data(), T_Algo::n_coefs, i, j, k)
+                                 - dt * T_Algo::UpwardDx(Ey, coefs.x.data(), T_Algo::n_coefs, i, j, k);
+
+                }
+            );
+        }
 
         // div(B) cleaning correction for errors in magnetic Gauss law (div(B) = 0)
         if (Gfield)
@@ -196,15 +205,15 @@ void FiniteDifferenceSolver::EvolveBCartesian (
 
                 [=] AMREX_GPU_DEVICE (int i, int j, int k)
                 {
-                    Bx(i,j,k) += dt * T_Algo::DownwardDx(G, coefs_x, n_coefs_x, i, j, k);
+                    Bx(i,j,k) += dt * T_Algo::DownwardDx(G, coefs.x.data(), T_Algo::n_coefs, i, j, k);
                 },
                 [=] AMREX_GPU_DEVICE (int i, int j, int k)
                 {
-                    By(i,j,k) += dt * T_Algo::DownwardDy(G, coefs_y, n_coefs_y, i, j, k);
+                    By(i,j,k) += dt * T_Algo::DownwardDy(G, coefs.y.data(), T_Algo::n_coefs, i, j, k);
                 },
                 [=] AMREX_GPU_DEVICE (int i, int j, int k)
                 {
-                    Bz(i,j,k) += dt * T_Algo::DownwardDz(G, coefs_z, n_coefs_z, i, j, k);
+                    Bz(i,j,k) += dt * T_Algo::DownwardDz(G, coefs.z.data(), T_Algo::n_coefs, i, j, k);
                 }
             );
         }
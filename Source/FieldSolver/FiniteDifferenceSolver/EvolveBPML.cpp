@@ -6,7 +6,9 @@
  */
 #include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceSolver.H"
 
+#include "BoundaryConditions/PML.H"
 #include "BoundaryConditions/PMLComponent.H"
+#include "BoundaryConditions/WarpX_PML_kernels.H"
 #include "Fields.H"
 
 #ifndef WARPX_DIM_RZ
@@ -46,7 +48,9 @@ void FiniteDifferenceSolver::EvolveBPML (
     PatchType patch_type,
     int level,
     amrex::Real const dt,
-    const bool dive_cleaning
+    const bool dive_cleaning,
+    MultiSigmaBox const* damping_sigba,
+    const bool divb_cleaning
 )
 {
     using warpx::fields::FieldType;
@@ -54,7 +58,7 @@ void FiniteDifferenceSolver::EvolveBPML (
     // Select algorithm (The choice of algorithm is a runtime option,
     // but we compile code for each algorithm, using templates)
 #ifdef WARPX_DIM_RZ
-    amrex::ignore_unused(fields, patch_type, level, dt, dive_cleaning);
+    amrex::ignore_unused(fields, patch_type, level, dt, dive_cleaning, damping_sigba, divb_cleaning);
     WARPX_ABORT_WITH_MESSAGE(
         "PML are not implemented in cylindrical geometry.");
 #else
@@ -65,15 +69,15 @@ void FiniteDifferenceSolver::EvolveBPML (
 
     if (m_grid_type == ablastr::utils::enums::GridType::Collocated) {
 
-        EvolveBPMLCartesian <CartesianNodalAlgorithm> (Bfield, Efield, dt, dive_cleaning);
+        EvolveBPMLCartesian <CartesianNodalAlgorithm> (Bfield, Efield, dt, dive_cleaning, damping_sigba, divb_cleaning);
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee || m_fdtd_algo == ElectromagneticSolverAlgo::ECT) {
 
-        EvolveBPMLCartesian <CartesianYeeAlgorithm> (Bfield, Efield, dt, dive_cleaning);
+        EvolveBPMLCartesian <CartesianYeeAlgorithm> (Bfield, Efield, dt, dive_cleaning, damping_sigba, divb_cleaning);
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
 
-        EvolveBPMLCartesian <CartesianCKCAlgorithm> (Bfield, Efield, dt, dive_cleaning);
+        EvolveBPMLCartesian <CartesianCKCAlgorithm> (Bfield, Efield, dt, dive_cleaning, damping_sigba, divb_cleaning);
 
     } else {
         WARPX_ABORT_WITH_MESSAGE(
@@ -90,7 +94,14 @@ void FiniteDifferenceSolver::EvolveBPMLCartesian (
     std::array< amrex::MultiFab*, 3 > Bfield,
     ablastr::fields::VectorField const Efield,
     amrex::Real const dt,
-    const bool dive_cleaning) {
+    const bool dive_cleaning,
+    MultiSigmaBox const* damping_sigba,
+    const bool divb_cleaning) {
+
+    const bool damp = (damping_sigba != nullptr);
+    const amrex::IntVect Bx_stag = Bfield[0]->ixType().toIntVect();
+    const amrex::IntVect By_stag = Bfield[1]->ixType().toIntVect();
+    const amrex::IntVect Bz_stag = Bfield[2]->ixType().toIntVect();
 
     // Loop through the grids, and over the tiles within each grid
 #ifdef AMREX_USE_OMP
@@ -119,6 +130,11 @@ void FiniteDifferenceSolver::EvolveBPMLCartesian (
         Box const& tby  = mfi.tilebox(Bfield[1]->ixType().ixType());
         Box const& tbz  = mfi.tilebox(Bfield[2]->ixType().ixType());
 
+        // Damping factors, applied to each point right after its update
+        // (this is the same as damping B in a separate pass, since the update
+        // of a point does not read B at other points)
+        const PMLDampingFactors f = damp ? (*damping_sigba)[mfi].GetDampingFactors() : PMLDampingFactors{};
+
         // Loop over the cells and update the fields
         amrex::ParallelFor(tbx, tby, tbz,
 
@@ -141,6 +157,12 @@ void FiniteDifferenceSolver::EvolveBPMLCartesian (
                     T_Algo::UpwardDy(Ez, coefs_y, n_coefs_y, i, j, k, PMLComp::zx)
                   + T_Algo::UpwardDy(Ez, coefs_y, n_coefs_y, i, j, k, PMLComp::zy)
                   + UpwardDy_Ez_zz);
+
+                if (damp) {
+                    warpx_damp_pml_bx(i, j, k, Bx, Bx_stag, f.sigma_fac_x, f.sigma_fac_y, f.sigma_fac_z,
+                                      f.sigma_star_fac_x, f.sigma_star_fac_y, f.sigma_star_fac_z,
+                                      f.x_lo, f.y_lo, f.z_lo, divb_cleaning);
+                }
             },
 
             [=] AMREX_GPU_DEVICE (int i, int j, int k){
@@ -162,6 +184,12 @@ void FiniteDifferenceSolver::EvolveBPMLCartesian (
                     UpwardDz_Ex_xx
                   + T_Algo::UpwardDz(Ex, coefs_z, n_coefs_z, i, j, k, PMLComp::xy)
                   + T_Algo::UpwardDz(Ex, coefs_z, n_coefs_z, i, j, k, PMLComp::xz));
+
+                if (damp) {
+                    warpx_damp_pml_by(i, j, k, By, By_stag, f.sigma_fac_x, f.sigma_fac_y, f.sigma_fac_z,
+                                      f.sigma_star_fac_x, f.sigma_star_fac_y, f.sigma_star_fac_z,
+                                      f.x_lo, f.y_lo, f.z_lo, divb_cleaning);
+                }
             },
 
             [=] AMREX_GPU_DEVICE (int i, int j, int k){
@@ -183,6 +211,12 @@ void FiniteDifferenceSolver::EvolveBPMLCartesian (
                     T_Algo::UpwardDx(Ey, coefs_x, n_coefs_x, i, j, k, PMLComp::yx)
                   + T_Algo::UpwardDx(Ey, coefs_x, n_coefs_x, i, j, k, PMLComp::yz)
                   + UpwardDx_Ey_yy);
+
+                if (damp) {
+                    warpx_damp_pml_bz(i, j, k, Bz, Bz_stag, f.sigma_fac_x, f.sigma_fac_y, f.sigma_fac_z,
+                                      f.sigma_star_fac_x, f.sigma_star_fac_y, f.sigma_star_fac_z,
+                                      f.x_lo, f.y_lo, f.z_lo, divb_cleaning);
+                }
             }
 
         );
@@ -0,0 +1,254 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceSolver.H"
+
+#include "BoundaryConditions/CPML.H"
+#include "Fields.H"
+#ifndef WARPX_DIM_RZ
+#   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianYeeAlgorithm.H"
+#   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianCKCAlgorithm.H"
+#   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianNodalAlgorithm.H"
+#   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/StencilCoefficients.H"
+#endif
+#include "Utils/TextMsg.H"
+#include "Utils/WarpXAlgorithmSelection.H"
+#include "Utils/WarpXConst.H"
+
+#include <ablastr/fields/MultiFabRegister.H>
+
+#include <AMReX.H>
+#include <AMReX_Array4.H>
+#include <AMReX_Box.H>
+#include <AMReX_GpuControl.H>
+#include <AMReX_GpuLaunch.H>
+#include <AMReX_GpuQualifiers.H>
+#include <AMReX_MFIter.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_REAL.H>
+
+using namespace amrex;
+
+#ifndef WARPX_DIM_RZ
+namespace
+{
+    /** Derivative along the physical direction p (0: x, 1: y, 2: z), from the cell centers to the nodes */
+    template <typename T_Algo, typename T_Coefs>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    amrex::Real DownwardD (int p, amrex::Array4<amrex::Real const> const& F,
+                           T_Coefs const& coefs, int i, int j, int k)
+    {
+        if (p == 0) { return T_Algo::DownwardDx(F, coefs.x.data(), T_Algo::n_coefs, i, j, k); }
+        if (p == 1) { return T_Algo::DownwardDy(F, coefs.y.data(), T_Algo::n_coefs, i, j, k); }
+        return T_Algo::DownwardDz(F, coefs.z.data(), T_Algo::n_coefs, i, j, k);
+    }
+
+    /** Derivative along the physical direction p (0: x, 1: y, 2: z), from the nodes to the cell centers */
+    template <typename T_Algo, typename T_Coefs>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    amrex::Real UpwardD (int p, amrex::Array4<amrex::Real const> const& F,
+                         T_Coefs const& coefs, int i, int j, int k)
+    {
+        if (p == 0) { return T_Algo::UpwardDx(F, coefs.x.data(), T_Algo::n_coefs, i, j, k); }
+        if (p == 1) { return T_Algo::UpwardDy(F, coefs.y.data(), T_Algo::n_coefs, i, j, k); }
+        return T_Algo::UpwardDz(F, coefs.z.data(), T_Algo::n_coefs, i, j, k);
+    }
+}
+#endif
+
+void FiniteDifferenceSolver::EvolveECPML (
+    ablastr::fields::MultiFabRegister& fields,
+    int lev,
+    CPML& cpml,
+    amrex::Real const dt )
+{
+#ifdef WARPX_DIM_RZ
+    amrex::ignore_unused(fields, lev, cpml, dt);
+    WARPX_ABORT_WITH_MESSAGE("CPML are not implemented in cylindrical geometry.");
+#else
+    using warpx::fields::FieldType;
+
+    const ablastr::fields::VectorField Efield = fields.get_alldirs(FieldType::Efield_fp, lev);
+    const ablastr::fields::VectorField Bfield = fields.get_alldirs(FieldType::Bfield_fp, lev);
+
+    if (m_grid_type == ablastr::utils::enums::GridType::Collocated) {
+
+        EvolveECPMLCartesian <CartesianNodalAlgorithm> (Efield, Bfield, cpml, dt);
+
+    } else if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee) {
+
+        EvolveECPMLCartesian <CartesianYeeAlgorithm> (Efield, Bfield, cpml, dt);
+
+    } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
+
+        EvolveECPMLCartesian <CartesianCKCAlgorithm> (Efield, Bfield, cpml, dt);
+
+    } else {
+        WARPX_ABORT_WITH_MESSAGE("EvolveECPML: Unknown algorithm");
+    }
+#endif
+}
+
+void FiniteDifferenceSolver::EvolveBCPML (
+    ablastr::fields::MultiFabRegister& fields,
+    int lev,
+    CPML& cpml,
+    amrex::Real const dt )
+{
+#ifdef WARPX_DIM_RZ
+    amrex::ignore_unused(fields, lev, cpml, dt);
+    WARPX_ABORT_WITH_MESSAGE("CPML are not implemented in cylindrical geometry.");
+#else
+    using warpx::fields::FieldType;
+
+    const ablastr::fields::VectorField Bfield = fields.get_alldirs(FieldType::Bfield_fp, lev);
+    const ablastr::fields::VectorField Efield = fields.get_alldirs(FieldType::Efield_fp, lev);
+
+    if (m_grid_type == ablastr::utils::enums::GridType::Collocated) {
+
+        EvolveBCPMLCartesian <CartesianNodalAlgorithm> (Bfield, Efield, cpml, dt);
+
+    } else if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee) {
+
+        EvolveBCPMLCartesian <CartesianYeeAlgorithm> (Bfield, Efield, cpml, dt);
+
+    } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
+
+        EvolveBCPMLCartesian <CartesianCKCAlgorithm> (Bfield, Efield, cpml, dt);
+
+    } else {
+        WARPX_ABORT_WITH_MESSAGE("EvolveBCPML: Unknown algorithm");
+    }
+#endif
+}
+
+
+#ifndef WARPX_DIM_RZ
+
+template<typename T_Algo>
+void FiniteDifferenceSolver::EvolveECPMLCartesian (
+    ablastr::fields::VectorField const& Efield,
+    ablastr::fields::VectorField const& Bfield,
+    CPML& cpml, amrex::Real const dt ) {
+
+    auto const coefs = StencilCoefficients<T_Algo::n_coefs>::FromVectors(
+        m_h_stencil_coefs_x, m_h_stencil_coefs_y, m_h_stencil_coefs_z);
+    Real constexpr c2 = PhysConst::c * PhysConst::c;
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        if (!cpml.HasDirection(idim)) { continue; }
+
+        // The layers normal to the direction p only modify the derivatives along p:
+        // E_comp1 has a term -dB_comp2/dp and E_comp2 a term +dB_comp1/dp
+        int const p = CPML::PhysicalDirection(idim);
+        int const comp1 = (p + 1) % 3;
+        int const comp2 = (p + 2) % 3;
+        CPMLCoefficients const cc = cpml.GetCoefficientsE(idim, dt);
+        MultiFab& psi_1 = cpml.Psi(idim, 0);
+        MultiFab& psi_2 = cpml.Psi(idim, 1);
+        int const s1 = psi_1.ixType().nodeCentered(idim) ? 1 : 0;
+        int const s2 = psi_2.ixType().nodeCentered(idim) ? 1 : 0;
+
+        // Loop over the parts of the grids that overlap with the layers
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for ( MFIter mfi(psi_1, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+
+            int const gid = cpml.GridIndex(idim, mfi.index());
+            Array4<Real> const& E1 = Efield[comp1]->array(gid);
+            Array4<Real> const& E2 = Efield[comp2]->array(gid);
+            Array4<Real const> const& B1 = Bfield[comp1]->const_array(gid);
+            Array4<Real const> const& B2 = Bfield[comp2]->const_array(gid);
+            Array4<Real> const& P1 = psi_1.array(mfi);
+            Array4<Real> const& P2 = psi_2.array(mfi);
+
+            Box const& tb1 = mfi.tilebox(psi_1.ixType().toIntVect());
+            Box const& tb2 = mfi.tilebox(psi_2.ixType().toIntVect());
+
+            amrex::ParallelFor(tb1, tb2,
+
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                    int const n = CPML::Index(idim, i, j, k) - cc.lo;
+                    P1(i, j, k) = cc.b[s1][n] * P1(i, j, k)
+                                + cc.a[s1][n] * DownwardD<T_Algo>(p, B2, coefs, i, j, k);
+                    E1(i, j, k) -= c2 * dt * P1(i, j, k);
+                },
+
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                    int const n = CPML::Index(idim, i, j, k) - cc.lo;
+                    P2(i, j, k) = cc.b[s2][n] * P2(i, j, k)
+                                + cc.a[s2][n] * DownwardD<T_Algo>(p, B1, coefs, i, j, k);
+                    E2(i, j, k) += c2 * dt * P2(i, j, k);
+                }
+            );
+        }
+    }
+}
+
+template<typename T_Algo>
+void FiniteDifferenceSolver::EvolveBCPMLCartesian (
+    ablastr::fields::VectorField const& Bfield,
+    ablastr::fields::VectorField const& Efield,
+    CPML& cpml, amrex::Real const dt ) {
+
+    auto const coefs = StencilCoefficients<T_Algo::n_coefs>::FromVectors(
+        m_h_stencil_coefs_x, m_h_stencil_coefs_y, m_h_stencil_coefs_z);
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        if (!cpml.HasDirection(idim)) { continue; }
+
+        // The layers normal to the direction p only modify the derivatives along p:
+        // B_comp1 has a term +dE_comp2/dp and B_comp2 a term -dE_comp1/dp
+        int const p = CPML::PhysicalDirection(idim);
+        int const comp1 = (p + 1) % 3;
+        int const comp2 = (p + 2) % 3;
+        CPMLCoefficients const cc = cpml.GetCoefficientsB(idim, dt);
+        MultiFab& psi_1 = cpml.Psi(idim, 2);
+        MultiFab& psi_2 = cpml.Psi(idim, 3);
+        int const s1 = psi_1.ixType().nodeCentered(idim) ? 1 : 0;
+        int const s2 = psi_2.ixType().nodeCentered(idim) ? 1 : 0;
+
+        // Loop over the parts of the grids that overlap with the layers
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for ( MFIter mfi(psi_1, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+
+            int const gid = cpml.GridIndex(idim, mfi.index());
+            Array4<Real> const& B1 = Bfield[comp1]->array(gid);
+            Array4<Real> const& B2 = Bfield[comp2]->array(gid);
+            Array4<Real const> const& E1 = Efield[comp1]->const_array(gid);
+            Array4<Real const> const& E2 = Efield[comp2]->const_array(gid);
+            Array4<Real> const& P1 = psi_1.array(mfi);
+            Array4<Real> const& P2 = psi_2.array(mfi);
+
+            Box const& tb1 = mfi.tilebox(psi_1.ixType().toIntVect());
+            Box const& tb2 = mfi.tilebox(psi_2.ixType().toIntVect());
+
+            amrex::ParallelFor(tb1, tb2,
+
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                    int const n = CPML::Index(idim, i, j, k) - cc.lo;
+                    P1(i, j, k) = cc.b[s1][n] * P1(i, j, k)
+                                + cc.a[s1][n] * UpwardD<T_Algo>(p, E2, coefs, i, j, k);
+                    B1(i, j, k) += dt * P1(i, j, k);
+                },
+
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                    int const n = CPML::Index(idim, i, j, k) - cc.lo;
+                    P2(i, j, k) = cc.b[s2][n] * P2(i, j, k)
+                                + cc.a[s2][n] * UpwardD<T_Algo>(p, E1, coefs, i, j, k);
+                    B2(i, j, k) -= dt * P2(i, j, k);
+                }
+            );
+        }
+    }
+}
+
+#endif // corresponds to ifndef WARPX_DIM_RZ
@@ -11,6 +11,8 @@
 #   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianYeeAlgorithm.H"
 #   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianCKCAlgorithm.H"
 #   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianNodalAlgorithm.H"
+#   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CartesianYeeLineKernels.H"
+#   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/StencilCoefficients.H"
 #else
 #   include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceAlgorithms/CylindricalYeeAlgorithm.H"
 #endif
@@ -43,6 +45,7 @@
 
 #include <array>
 #include <memory>
+#include <type_traits>
 
 using namespace amrex;
 using namespace ablastr::fields;
@@ -113,6 +116,12 @@ void FiniteDifferenceSolver::EvolveECartesian (
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     Real constexpr c2 = PhysConst::c * PhysConst::c;
 
+    // Stencil coefficients, passed by value to the kernels
+    auto const coefs = StencilCoefficients<T_Algo::n_coefs>::FromVectors(
+        m_h_stencil_coefs_x, m_h_stencil_coefs_y, m_h_stencil_coefs_z);
+    bool const use_line_kernels = std::is_same_v<T_Algo, CartesianYeeAlgorithm> && m_line_kernels
+                                  && !EB::enabled();
+
     // Loop through the grids, and over the tiles within each grid
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -143,56 +152,57 @@ void FiniteDifferenceSolver::EvolveECartesian (
             update_Ez_arr = eb_update_E[2]->array(mfi);
         }
 
-        // Extract stencil coefficients
-        Real const * const AMREX_RESTRICT coefs_x = m_stencil_coefs_x.dataPtr();
-        auto const n_coefs_x = static_cast<int>(m_stencil_coefs_x.size());
-        Real const * const AMREX_RESTRICT coefs_y = m_stencil_coefs_y.dataPtr();
-        auto const n_coefs_y = static_cast<int>(m_stencil_coefs_y.size());
-        Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
-        auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
-
         // Extract tileboxes for which to loop
         Box const& tex  = mfi.tilebox(Efield[0]->ixType().toIntVect());
         Box const& tey  = mfi.tilebox(Efield[1]->ixType().toIntVect());
         Box const& tez  = mfi.tilebox(Efield[2]->ixType().toIntVect());
 
-        // Loop over the cells and update the fields
-        amrex::ParallelFor(tex, tey, tez,
+        if (use_line_kernels) {
 
-            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+            // Vectorized update on lines of cells (CPU only)
+            CartesianYeeLineKernels::EvolveE(tex, tey, tez, Ex, Ey, Ez, Bx, By, Bz, jx, jy, jz,
+                coefs.x[0], coefs.y[0], coefs.z[0], dt);
 
-                // Skip field push in the embedded boundaries
-                if (update_Ex_arr && update_Ex_arr(i, j, k) == 0) { return; }
+        } else {
 
-                Ex(i, j, k) += c2 * dt * (
-                    - T_Algo::DownwardDz(By, coefs_z, n_coefs_z, i, j, k)
-                    + T_Algo::DownwardDy(Bz, coefs_y, n_coefs_y, i, j, k)
-                    - PhysConst::mu0 * jx(i, j, k) );
-            },
+            // Loop over the cells and update the fields
+            amrex::ParallelFor(tex, tey, tez,
 
-            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-                // Skip field push in the embedded boundaries
-                if (update_Ey_arr && update_Ey_arr(i, j, k) == 0) { return; }
+                    // Skip field push in the embedded boundaries
+                    if (update_Ex_arr && update_Ex_arr(i, j, k) == 0) { return; }
 
-                Ey(i, j, k) += c2 * dt * (
-                    - T_Algo::DownwardDx(Bz, coefs_x, n_coefs_x, i, j, k)
-                    + T_Algo::DownwardDz(Bx, coefs_z, n_coefs_z, i, j, k)
-                    - PhysConst::mu0 * jy(i, j, k) );
-            },
+                    Ex(i, j, k) += c2 * dt * (
+                        - T_Algo::DownwardDz(By, coefs.z.data(), T_Algo::n_coefs, i, j, k)
+                        + T_Algo::DownwardDy(Bz, coefs.y.data(), T_Algo::n_coefs, i, j, k)
+                        - PhysConst::mu0 * jx(i, j, k) );
+                },
 
-            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-                // Skip field push in the embedded boundaries
-                if (update_Ez_arr && update_Ez_arr(i, j, k) == 0) { return; }
+                    // Skip field push in the embedded boundaries
+                    if (update_Ey_arr && update_Ey_arr(i, j, k) == 0) { return; }
 
-                Ez(i, j, k) += c2 * dt * (
-                    - T_Algo::DownwardDy(Bx, coefs_y, n_coefs_y, i, j, k)
-                    + T_Algo::DownwardDx(By, coefs_x, n_coefs_x, i, j, k)
-                    - PhysConst::mu0 * jz(i, j, k) );
-            }
+                    Ey(i, j, k) += c2 * dt * (
+                        - T_Algo::DownwardDx(Bz, coefs.x.data(), T_Algo::n_coefs, i, j, k)
+                        + T_Algo::DownwardDz(Bx, coefs.z.data(), T_Algo::n_coefs, i, j, k)
+                        - PhysConst::mu0 * jy(i, j, k) );
+                },
+
+                [=] AMREX_GPU_DEVICE (int i, int j, int k){
+
+                    // Skip field push in the embedded boundaries
+                    if (update_Ez_arr && update_Ez_arr(i, j, k) == 0) { return; }
+
+                    Ez(i, j, k) += c2 * dt * (
+                        - T_Algo::DownwardDy(Bx, coefs.y.data(), T_Algo::n_coefs, i, j, k)
+                        + T_Algo::DownwardDx(By, coefs.x.data(), T_Algo::n_coefs, i, j, k)
+                        - PhysConst::mu0 * jz(i, j, k) );
+                }
 
-        );
+            );
+        }
 
         // If F is not a null pointer, further update E using the grad(F) term
         // (hyperbolic correction for errors in charge conservation)
@@ -205,13 +215,13 @@ void FiniteDifferenceSolver::EvolveECartesian (
             amrex::ParallelFor(tex, tey, tez,
 
                 [=] AMREX_GPU_DEVICE (int i, int j, int k){
-                    Ex(i, j, k) += c2 * dt * T_Algo::UpwardDx(F, coefs_x, n_coefs_x, i, j, k);
+                    Ex(i, j, k) += c2 * dt * T_Algo::UpwardDx(F, coefs.x.data(), T_Algo::n_coefs, i, j, k);
                 },
                 [=] AMREX_GPU_DEVICE (int i, int j, int k){
-                    Ey(i, j, k) += c2 * dt * T_Algo::UpwardDy(F, coefs_y, n_coefs_y, i, j, k);
+                    Ey(i, j, k) += c2 * dt * T_Algo::UpwardDy(F, coefs.y.data(), T_Algo::n_coefs, i, j, k);
                 },
                 [=] AMREX_GPU_DEVICE (int i, int j, int k){
-                    Ez(i, j, k) += c2 * dt * T_Algo::UpwardDz(F, coefs_z, n_coefs_z, i, j, k);
+                    Ez(i, j, k) += c2 * dt * T_Algo::UpwardDz(F, coefs.z.data(), T_Algo::n_coefs, i, j, k);
                 }
 
             );
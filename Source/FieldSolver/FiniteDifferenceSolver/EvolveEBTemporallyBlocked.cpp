@@ -0,0 +1,247 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "FiniteDifferenceSolver.H"
+
+#include "Fields.H"
+#ifndef WARPX_DIM_RZ
+#   include "FiniteDifferenceAlgorithms/CartesianYeeAlgorithm.H"
+#   include "FiniteDifferenceAlgorithms/CartesianCKCAlgorithm.H"
+#endif
+#include "Utils/TextMsg.H"
+#include "Utils/WarpXAlgorithmSelection.H"
+#include "Utils/WarpXConst.H"
+#include "WarpX.H"
+
+#include <ablastr/fields/MultiFabRegister.H>
+
+#include <AMReX.H>
+#include <AMReX_Arena.H>
+#include <AMReX_Array4.H>
+#include <AMReX_Box.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_GpuAtomic.H>
+#include <AMReX_GpuControl.H>
+#include <AMReX_GpuDevice.H>
+#include <AMReX_GpuLaunch.H>
+#include <AMReX_GpuQualifiers.H>
+#include <AMReX_IndexType.H>
+#include <AMReX_LayoutData.H>
+#include <AMReX_MFIter.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_REAL.H>
+
+#include <algorithm>
+#include <array>
+
+using namespace amrex;
+using namespace amrex::literals;
+
+/**
+ * \brief Update E and B over one full timestep, block by block
+ */
+void FiniteDifferenceSolver::EvolveEBTemporallyBlocked (
+    ablastr::fields::MultiFabRegister& fields,
+    int lev,
+    [[maybe_unused]] amrex::Real const dt,
+    [[maybe_unused]] int const block_size )
+{
+    using warpx::fields::FieldType;
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(block_size >= temporal_blocking_halo,
+        "EvolveEBTemporallyBlocked: the blocks must be at least as thick as the halo");
+
+    const ablastr::fields::VectorField Efield = fields.get_alldirs(FieldType::Efield_fp, lev);
+    const ablastr::fields::VectorField Bfield = fields.get_alldirs(FieldType::Bfield_fp, lev);
+    const ablastr::fields::VectorField Jfield = fields.get_alldirs(FieldType::current_fp, lev);
+
+#ifdef WARPX_DIM_RZ
+    amrex::ignore_unused(Efield, Bfield, Jfield);
+    WARPX_ABORT_WITH_MESSAGE("EvolveEBTemporallyBlocked: not implemented in RZ geometry");
+#else
+    if (m_grid_type != GridType::Collocated && m_fdtd_algo == ElectromagneticSolverAlgo::Yee) {
+
+        EvolveEBTemporallyBlockedCartesian <CartesianYeeAlgorithm> ( Efield, Bfield, Jfield, lev, dt, block_size );
+
+    } else if (m_grid_type != GridType::Collocated && m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
+
+        EvolveEBTemporallyBlockedCartesian <CartesianCKCAlgorithm> ( Efield, Bfield, Jfield, lev, dt, block_size );
+
+    } else {
+        WARPX_ABORT_WITH_MESSAGE("EvolveEBTemporallyBlocked: only implemented for the staggered Yee and CKC algorithms");
+    }
+#endif
+}
+
+
+#ifndef WARPX_DIM_RZ
+
+template<typename T_Algo>
+void FiniteDifferenceSolver::EvolveEBTemporallyBlockedCartesian (
+    ablastr::fields::VectorField const& Efield,
+    ablastr::fields::VectorField const& Bfield,
+    ablastr::fields::VectorField const& Jfield,
+    int lev, amrex::Real const dt, int const block_size ) {
+
+    amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
+    Real constexpr c2 = PhysConst::c * PhysConst::c;
+    Real const half_dt = 0.5_rt * dt;
+
+    // The grids are cut into blocks along their last dimension
+    constexpr int dir = AMREX_SPACEDIM - 1;
+    constexpr int halo = temporal_blocking_halo;
+
+    // Index types of Ex, Ey, Ez, Bx, By, Bz
+    const std::array<amrex::IndexType,6> ixtypes{
+        Efield[0]->ixType(), Efield[1]->ixType(), Efield[2]->ixType(),
+        Bfield[0]->ixType(), Bfield[1]->ixType(), Bfield[2]->ixType()};
+
+    // Extract stencil coefficients
+    Real const * const AMREX_RESTRICT coefs_x = m_stencil_coefs_x.dataPtr();
+    auto const n_coefs_x = static_cast<int>(m_stencil_coefs_x.size());
+    Real const * const AMREX_RESTRICT coefs_y = m_stencil_coefs_y.dataPtr();
+    auto const n_coefs_y = static_cast<int>(m_stencil_coefs_y.size());
+    Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
+    auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
+
+    // Loop through the grids. The grids are not tiled: the blocks of a grid
+    // are processed in order by the same thread (see below).
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for ( MFIter mfi(*Efield[0], false); mfi.isValid(); ++mfi ) {
+        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        {
+            amrex::Gpu::synchronize();
+        }
+        auto wt = static_cast<amrex::Real>(amrex::second());
+
+        std::array<amrex::FArrayBox*,6> const global_fabs{
+            &(*Efield[0])[mfi], &(*Efield[1])[mfi], &(*Efield[2])[mfi],
+            &(*Bfield[0])[mfi], &(*Bfield[1])[mfi], &(*Bfield[2])[mfi]};
+        Array4<Real const> const& jx = Jfield[0]->const_array(mfi);
+        Array4<Real const> const& jy = Jfield[1]->const_array(mfi);
+        Array4<Real const> const& jz = Jfield[2]->const_array(mfi);
+
+        Box const cell_box = amrex::enclosedCells(mfi.validbox());
+        int const lo = cell_box.smallEnd(dir);
+        int const hi = cell_box.bigEnd(dir);
+
+        // Each block is updated in a local copy, which is written back once the
+        // next block has been copied: the halo of the next block overlaps the
+        // current block and must contain the fields at the beginning of the step.
+        // Blocks are at least as thick as the halo, so that the halo of a block
+        // does not extend beyond the previous block.
+        std::array<std::array<amrex::FArrayBox,6>,2> local;
+        Box previous_block;
+
+        auto write_back = [&] (std::array<amrex::FArrayBox,6> const& local_fields, Box const& block) {
+            for (int n = 0; n < 6; ++n) {
+                Box wbx = amrex::convert(block, ixtypes[n]);
+                // Nodal points on the upper face of a block belong to the next block
+                if (ixtypes[n].nodeCentered(dir) && block.bigEnd(dir) < hi) { wbx.growHi(dir, -1); }
+                global_fabs[n]->copy<RunOn::Device>(local_fields[n], wbx, 0, wbx, 0, 1);
+            }
+        };
+
+        int ilocal = 0;
+        for (int block_lo = lo; block_lo <= hi; block_lo += block_size) {
+            Box block = cell_box;
+            block.setSmall(dir, block_lo);
+            block.setBig(dir, std::min(block_lo + block_size - 1, hi));
+
+            // Copy E and B in the block and its halo
+            auto& local_fields = local[ilocal];
+            for (int n = 0; n < 6; ++n) {
+                Box const bx = amrex::convert(amrex::grow(block, halo), ixtypes[n]);
+                local_fields[n].resize(bx, 1, The_Async_Arena());
+                local_fields[n].copy<RunOn::Device>(*global_fabs[n], bx, 0, bx, 0, 1);
+            }
+
+            if (previous_block.ok()) { write_back(local[1 - ilocal], previous_block); }
+
+            Array4<Real> const& Ex = local_fields[0].array();
+            Array4<Real> const& Ey = local_fields[1].array();
+            Array4<Real> const& Ez = local_fields[2].array();
+            Array4<Real> const& Bx = local_fields[3].array();
+            Array4<Real> const& By = local_fields[4].array();
+            Array4<Real> const& Bz = local_fields[5].array();
+
+            // Each sub-update is valid in one cell less than the previous one
+            for (int sub = 0; sub < 3; ++sub) {
+                Box const grown_block = amrex::grow(block, halo - 1 - sub);
+
+                if (sub == 1) {
+
+                    // E from n to n+1
+                    amrex::ParallelFor(
+                        amrex::convert(grown_block, ixtypes[0]),
+                        amrex::convert(grown_block, ixtypes[1]),
+                        amrex::convert(grown_block, ixtypes[2]),
+
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                            Ex(i, j, k) += c2 * dt * (
+                                - T_Algo::DownwardDz(By, coefs_z, n_coefs_z, i, j, k)
+                                + T_Algo::DownwardDy(Bz, coefs_y, n_coefs_y, i, j, k)
+                                - PhysConst::mu0 * jx(i, j, k) );
+                        },
+
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                            Ey(i, j, k) += c2 * dt * (
+                                - T_Algo::DownwardDx(Bz, coefs_x, n_coefs_x, i, j, k)
+                                + T_Algo::DownwardDz(Bx, coefs_z, n_coefs_z, i, j, k)
+                                - PhysConst::mu0 * jy(i, j, k) );
+                        },
+
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                            Ez(i, j, k) += c2 * dt * (
+                                - T_Algo::DownwardDy(Bx, coefs_y, n_coefs_y, i, j, k)
+                                + T_Algo::DownwardDx(By, coefs_x, n_coefs_x, i, j, k)
+                                - PhysConst::mu0 * jz(i, j, k) );
+                        }
+                    );
+
+                } else {
+
+                    // B from n to n+1/2, and from n+1/2 to n+1
+                    amrex::ParallelFor(
+                        amrex::convert(grown_block, ixtypes[3]),
+                        amrex::convert(grown_block, ixtypes[4]),
+                        amrex::convert(grown_block, ixtypes[5]),
+
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                            Bx(i, j, k) += half_dt * T_Algo::UpwardDz(Ey, coefs_z, n_coefs_z, i, j, k)
+                                         - half_dt * T_Algo::UpwardDy(Ez, coefs_y, n_coefs_y, i, j, k);
+                        },
+
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                            By(i, j, k) += half_dt * T_Algo::UpwardDx(Ez, coefs_x, n_coefs_x, i, j, k)
+                                         - half_dt * T_Algo::UpwardDz(Ex, coefs_z, n_coefs_z, i, j, k);
+                        },
+
+                        [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                            Bz(i, j, k) += half_dt * T_Algo::UpwardDy(Ex, coefs_y, n_coefs_y, i, j, k)
+                                         - half_dt * T_Algo::UpwardDx(Ey, coefs_x, n_coefs_x, i, j, k);
+                        }
+                    );
+                }
+            }
+
+            previous_block = block;
+            ilocal = 1 - ilocal;
+        }
+        if (previous_block.ok()) { write_back(local[1 - ilocal], previous_block); }
+
+        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        {
+            amrex::Gpu::synchronize();
+            wt = static_cast<amrex::Real>(amrex::second()) - wt;
+            amrex::HostDevice::Atomic::Add( &(*cost)[mfi.index()], wt);
+        }
+    }
+}
+
+#endif // corresponds to ifndef WARPX_DIM_RZ
@@ -101,3 +101,14 @@ FiniteDifferenceSolver::FiniteDifferenceSolver (
     amrex::Gpu::synchronize();
 #endif
 }
+
+void
+FiniteDifferenceSolver::SetLineKernels (bool line_kernels)
+{
+#ifdef AMREX_USE_GPU
+    // The line kernels loop over the data on the host
+    amrex::ignore_unused(line_kernels);
+#else
+    m_line_kernels = line_kernels;
+#endif
+}
@@ -306,7 +306,7 @@ void HybridPICModel::HybridPICSolveE (
         );
     }
     // Allow execution of Python callback after E-field push
-    ExecutePythonCallback("afterEpush");
+    ExecutePythonCallback(PythonCallbackLocation::afterEpush);
 }
 
 void HybridPICModel::HybridPICSolveE (
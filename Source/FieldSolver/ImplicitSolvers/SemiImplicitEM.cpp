@@ -118,3 +118,14 @@ void SemiImplicitEM::ComputeRHS ( WarpXSolverVec&  a_RHS,
     // RHS = cvac^2*0.5*dt*( curl(Bg^{n+1/2}) - mu0*Jg^{n+1/2} )
     m_WarpX->ImplicitComputeRHSE(0.5_rt*m_dt, a_RHS);
 }
+
+void SemiImplicitEM::ComputeFieldRHS ( WarpXSolverVec&  a_RHS,
+                                 const WarpXSolverVec&  a_E,
+                                       amrex::Real      half_time )
+{
+    // Update WarpX-owned Efield_fp, without pushing the particles
+    m_WarpX->SetElectricFieldAndApplyBCs( a_E, half_time );
+
+    // RHS = cvac^2*0.5*dt*( curl(Bg^{n+1/2}) - mu0*Jg^{n+1/2} ), with Jg unchanged
+    m_WarpX->ImplicitComputeRHSE(0.5_rt*m_dt, a_RHS);
+}
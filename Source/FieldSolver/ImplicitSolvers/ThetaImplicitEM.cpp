@@ -140,6 +140,17 @@ void ThetaImplicitEM::ComputeRHS ( WarpXSolverVec&  a_RHS,
     m_WarpX->ImplicitComputeRHSE( m_theta*m_dt, a_RHS);
 }
 
+void ThetaImplicitEM::ComputeFieldRHS ( WarpXSolverVec&  a_RHS,
+                                  const WarpXSolverVec&  a_E,
+                                        amrex::Real      start_time )
+{
+    // Update WarpX-owned Efield_fp and Bfield_fp, without pushing the particles
+    UpdateWarpXFields( a_E, start_time );
+
+    // RHS = cvac^2*m_theta*dt*( curl(Bg^{n+theta}) - mu0*Jg^{n+1/2} ), with Jg unchanged
+    m_WarpX->ImplicitComputeRHSE( m_theta*m_dt, a_RHS);
+}
+
 void ThetaImplicitEM::UpdateWarpXFields ( const WarpXSolverVec&  a_E,
                                           amrex::Real start_time )
 {
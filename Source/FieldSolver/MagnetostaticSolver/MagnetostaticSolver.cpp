@@ -62,6 +62,7 @@ void
 WarpX::ComputeMagnetostaticField()
 {
     WARPX_PROFILE("WarpX::ComputeMagnetostaticField");
+    const auto timing = TimeRegion(TimingRegion::field_solve);
     // Fields have been reset in Electrostatic solver for this time step, these fields
     // are added into the B fields after electrostatic solve
 
@@ -123,7 +124,7 @@ WarpX::AddMagnetostaticFieldLabFrame()
     setVectorPotentialBC(m_fields.get_mr_levels_alldirs(FieldType::vector_potential_fp_nodal, finest_level));
 
     // Compute the vector potential A, by solving the Poisson equation
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE( !IsPythonCallbackInstalled("poissonsolver"),
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE( !IsPythonCallbackInstalled(PythonCallbackLocation::poissonsolver),
         "Python Level Poisson Solve not supported for Magnetostatic implementation.");
 
     // const amrex::Real magnetostatic_absolute_tolerance = self_fields_absolute_tolerance*PhysConst::c;
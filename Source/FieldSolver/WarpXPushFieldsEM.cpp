@@ -8,6 +8,7 @@
  */
 #include "WarpX.H"
 
+#include "BoundaryConditions/CPML.H"
 #include "BoundaryConditions/PML.H"
 #include "Evolve/WarpXDtType.H"
 #include "Fields.H"
@@ -29,6 +30,8 @@
 #include "WarpXPushFieldsEM_K.H"
 #include "WarpX_FDTD.H"
 
+#include <ablastr/utils/Communication.H>
+
 #include <AMReX.H>
 #ifdef AMREX_USE_SENSEI_INSITU
 #   include <AMReX_AmrMeshInSituBridge.H>
@@ -716,6 +719,8 @@ WarpX::PSATDScaleAverageFields (const amrex::Real scale_factor)
 void
 WarpX::PushPSATD (amrex::Real start_time)
 {
+    const auto timing = TimeRegion(TimingRegion::field_solve);
+
 #ifndef WARPX_USE_FFT
     amrex::ignore_unused(start_time);
     WARPX_ABORT_WITH_MESSAGE(
@@ -880,30 +885,33 @@ WarpX::PushPSATD (amrex::Real start_time)
 }
 
 void
-WarpX::EvolveB (amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
+WarpX::EvolveB (amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time, bool damp_pml_B)
 {
     for (int lev = 0; lev <= finest_level; ++lev) {
-        EvolveB(lev, a_dt, a_dt_type, start_time);
+        EvolveB(lev, a_dt, a_dt_type, start_time, damp_pml_B);
     }
 
     // Allow execution of Python callback after B-field push
-    ExecutePythonCallback("afterBpush");
+    ExecutePythonCallback(PythonCallbackLocation::afterBpush);
 }
 
 void
-WarpX::EvolveB (int lev, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
+WarpX::EvolveB (int lev, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time, bool damp_pml_B)
 {
     WARPX_PROFILE("WarpX::EvolveB()");
-    EvolveB(lev, PatchType::fine, a_dt, a_dt_type, start_time);
+    EvolveB(lev, PatchType::fine, a_dt, a_dt_type, start_time, damp_pml_B);
     if (lev > 0)
     {
-        EvolveB(lev, PatchType::coarse, a_dt, a_dt_type, start_time);
+        EvolveB(lev, PatchType::coarse, a_dt, a_dt_type, start_time, damp_pml_B);
     }
 }
 
 void
-WarpX::EvolveB (int lev, PatchType patch_type, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
+WarpX::EvolveB (int lev, PatchType patch_type, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time,
+                bool damp_pml_B)
 {
+    const auto timing = TimeRegion(TimingRegion::field_solve);
+
     // Evolve B field in regular cells
     if (patch_type == PatchType::fine) {
         m_fdtd_solver_fp[lev]->EvolveB( m_fields,
@@ -921,13 +929,20 @@ WarpX::EvolveB (int lev, PatchType patch_type, amrex::Real a_dt, DtType a_dt_typ
     if (do_pml && pml[lev]->ok()) {
         if (patch_type == PatchType::fine) {
             m_fdtd_solver_fp[lev]->EvolveBPML(
-                m_fields, patch_type, lev, a_dt, WarpX::do_dive_cleaning);
+                m_fields, patch_type, lev, a_dt, WarpX::do_dive_cleaning,
+                damp_pml_B ? &pml[lev]->GetMultiSigmaBox_fp() : nullptr, WarpX::do_pml_divb_cleaning);
         } else {
             m_fdtd_solver_cp[lev]->EvolveBPML(
-                m_fields, patch_type, lev, a_dt, WarpX::do_dive_cleaning);
+                m_fields, patch_type, lev, a_dt, WarpX::do_dive_cleaning,
+                damp_pml_B ? &pml[lev]->GetMultiSigmaBox_cp() : nullptr, WarpX::do_pml_divb_cleaning);
         }
     }
 
+    // Evolve B field in CPML cells
+    if (m_cpml && lev == 0 && patch_type == PatchType::fine) {
+        m_fdtd_solver_fp[lev]->EvolveBCPML(m_fields, lev, *m_cpml, a_dt);
+    }
+
     amrex::Real const new_time = start_time + a_dt;
     ApplyBfieldBoundary(lev, patch_type, a_dt_type, new_time);
 }
@@ -942,7 +957,7 @@ WarpX::EvolveE (amrex::Real a_dt, amrex::Real start_time)
     }
 
     // Allow execution of Python callback after E-field push
-    ExecutePythonCallback("afterEpush");
+    ExecutePythonCallback(PythonCallbackLocation::afterEpush);
 }
 
 void
@@ -959,6 +974,8 @@ WarpX::EvolveE (int lev, amrex::Real a_dt, amrex::Real start_time)
 void
 WarpX::EvolveE (int lev, PatchType patch_type, amrex::Real a_dt, amrex::Real start_time)
 {
+    const auto timing = TimeRegion(TimingRegion::field_solve);
+
     // Evolve E field in regular cells
     if (patch_type == PatchType::fine) {
         m_fdtd_solver_fp[lev]->EvolveE( m_fields,
@@ -995,6 +1012,11 @@ WarpX::EvolveE (int lev, PatchType patch_type, amrex::Real a_dt, amrex::Real sta
         }
     }
 
+    // Evolve E field in CPML cells
+    if (m_cpml && lev == 0 && patch_type == PatchType::fine) {
+        m_fdtd_solver_fp[lev]->EvolveECPML(m_fields, lev, *m_cpml, a_dt);
+    }
+
     amrex::Real const new_time = start_time + a_dt;
     ApplyEfieldBoundary(lev, patch_type, new_time);
 
@@ -1019,6 +1041,35 @@ WarpX::EvolveE (int lev, PatchType patch_type, amrex::Real a_dt, amrex::Real sta
 #endif
 }
 
+void
+WarpX::EvolveEBTemporallyBlocked (amrex::Real a_dt)
+{
+    WARPX_PROFILE("WarpX::EvolveEBTemporallyBlocked()");
+
+    using ablastr::fields::Direction;
+
+    // The blocks recompute E and B in their halo, which requires up-to-date guard cells
+    const amrex::IntVect ng_halo(FiniteDifferenceSolver::temporal_blocking_halo);
+    FillBoundaryE(ng_halo, WarpX::sync_nodal_points);
+    FillBoundaryB(ng_halo, WarpX::sync_nodal_points);
+
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        {
+            const auto timing = TimeRegion(TimingRegion::communication);
+            for (int idim = 0; idim < 3; ++idim) {
+                ablastr::utils::communication::FillBoundary(
+                    *m_fields.get(FieldType::current_fp, Direction{idim}, lev), amrex::IntVect(1),
+                    WarpX::do_single_precision_comms, Geom(lev).periodicity());
+            }
+        }
+
+        const auto timing = TimeRegion(TimingRegion::field_solve);
+        m_fdtd_solver_fp[lev]->EvolveEBTemporallyBlocked(m_fields, lev, a_dt, fdtd_block_size);
+
+        // The field boundaries are periodic: there are no boundary conditions to apply
+    }
+}
 
 void
 WarpX::EvolveF (amrex::Real a_dt, DtType a_dt_type)
@@ -1046,6 +1097,7 @@ WarpX::EvolveF (int lev, PatchType patch_type, amrex::Real a_dt, DtType a_dt_typ
     if (!do_dive_cleaning) { return; }
 
     WARPX_PROFILE("WarpX::EvolveF()");
+    const auto timing = TimeRegion(TimingRegion::field_solve);
 
     const int rhocomp = (a_dt_type == DtType::FirstHalf) ? 0 : 1;
 
@@ -1106,6 +1158,7 @@ WarpX::EvolveG (int lev, PatchType patch_type, amrex::Real a_dt, DtType /*a_dt_t
     if (!do_divb_cleaning) { return; }
 
     WARPX_PROFILE("WarpX::EvolveG()");
+    const auto timing = TimeRegion(TimingRegion::field_solve);
 
     bool const skip_lev0_coarse_patch = true;
 
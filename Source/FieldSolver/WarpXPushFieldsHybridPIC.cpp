@@ -27,6 +27,7 @@ void WarpX::HybridPICEvolveFields ()
     using warpx::fields::FieldType;
 
     WARPX_PROFILE("WarpX::HybridPICEvolveFields()");
+    const auto timing = TimeRegion(TimingRegion::field_solve);
 
     // The below deposition is hard coded for a single level simulation
     WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
@@ -16,6 +16,7 @@
 void WarpX::ComputeSpaceChargeField (bool const reset_fields)
 {
     WARPX_PROFILE("WarpX::ComputeSpaceChargeField");
+    const auto timing = TimeRegion(TimingRegion::field_solve);
     using ablastr::fields::Direction;
     using warpx::fields::FieldType;
 
@@ -10,6 +10,7 @@
  */
 #include "WarpX.H"
 
+#include "BoundaryConditions/CPML.H"
 #include "BoundaryConditions/PML.H"
 #if (defined WARPX_DIM_RZ) && (defined WARPX_USE_FFT)
 #   include "BoundaryConditions/PML_RZ.H"
@@ -601,9 +602,9 @@ WarpX::InitData ()
     {
         // Loop through species and calculate their space-charge field
         bool const reset_fields = false; // Do not erase previous user-specified values on the grid
-        ExecutePythonCallback("beforeInitEsolve");
+        ExecutePythonCallback(PythonCallbackLocation::beforeInitEsolve);
         ComputeSpaceChargeField(reset_fields);
-        ExecutePythonCallback("afterInitEsolve");
+        ExecutePythonCallback(PythonCallbackLocation::afterInitEsolve);
         if (electrostatic_solver_id == ElectrostaticSolverAlgo::LabFrameElectroMagnetostatic) {
             ComputeMagnetostaticField();
         }
@@ -614,7 +615,7 @@ WarpX::InitData ()
         }
     }
     else {
-        ExecutePythonCallback("afterInitatRestart");
+        ExecutePythonCallback(PythonCallbackLocation::afterInitatRestart);
     }
 
     if (restart_chkfile.empty() || write_diagnostics_on_restart) {
@@ -701,6 +702,7 @@ WarpX::InitFromScratch ()
     mypc->InitData();
 
     InitPML();
+    InitCPML();
 
 }
 
@@ -798,6 +800,45 @@ WarpX::ComputePMLFactors ()
     }
 }
 
+void
+WarpX::InitCPML ()
+{
+    using ablastr::fields::Direction;
+
+    amrex::IntVect do_cpml_lo(0), do_cpml_hi(0);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        do_cpml_lo[idim] = (WarpX::field_boundary_lo[idim] == FieldBoundaryType::CPML);
+        do_cpml_hi[idim] = (WarpX::field_boundary_hi[idim] == FieldBoundaryType::CPML);
+    }
+    if (do_cpml_lo == amrex::IntVect(0) && do_cpml_hi == amrex::IntVect(0)) { return; }
+
+#ifdef WARPX_DIM_RZ
+    WARPX_ABORT_WITH_MESSAGE("The CPML boundary is not implemented in cylindrical geometry.");
+#endif
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        electromagnetic_solver_id == ElectromagneticSolverAlgo::Yee ||
+        electromagnetic_solver_id == ElectromagneticSolverAlgo::CKC,
+        "The CPML boundary can only be used with the Yee and CKC solvers.");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        evolve_scheme == EvolveScheme::Explicit,
+        "The CPML boundary can only be used with the explicit evolve scheme.");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        em_solver_medium != MediumForEM::Macroscopic,
+        "The CPML boundary can only be used in vacuum.");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        max_level == 0 && !do_moving_window && !EB::enabled(),
+        "The CPML boundary cannot be used with mesh refinement, the moving window or embedded boundaries.");
+
+    std::array<amrex::IndexType,3> E_ixtypes, B_ixtypes;
+    for (int dir = 0; dir < 3; ++dir) {
+        E_ixtypes[dir] = m_fields.get(FieldType::Efield_fp, Direction{dir}, 0)->ixType();
+        B_ixtypes[dir] = m_fields.get(FieldType::Bfield_fp, Direction{dir}, 0)->ixType();
+    }
+    m_cpml = std::make_unique<CPML>(
+        boxArray(0), DistributionMap(0), Geom(0), do_cpml_lo, do_cpml_hi,
+        cpml_ncell, cpml_order, cpml_reflection, E_ixtypes, B_ixtypes);
+}
+
 void
 WarpX::ComputeMaxStep ()
 {
@@ -1393,7 +1434,7 @@ WarpX::LoadExternalFields (int const lev)
 
     if (lev == finestLevel()) {
         // Call Python callback which might write values to external field multifabs
-        ExecutePythonCallback("loadExternalFields");
+        ExecutePythonCallback(PythonCallbackLocation::loadExternalFields);
     }
     // External particle fields
 
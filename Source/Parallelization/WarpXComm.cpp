@@ -706,6 +706,8 @@ WarpX::FillBoundaryE (int lev, IntVect ng, std::optional<bool> nodal_sync)
 void
 WarpX::FillBoundaryE (const int lev, const PatchType patch_type, const amrex::IntVect ng, std::optional<bool> nodal_sync)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     std::array<amrex::MultiFab*,3> mf;
     amrex::Periodicity period;
 
@@ -771,6 +773,8 @@ WarpX::FillBoundaryB (int lev, IntVect ng, std::optional<bool> nodal_sync)
 void
 WarpX::FillBoundaryB (const int lev, const PatchType patch_type, const amrex::IntVect ng, std::optional<bool> nodal_sync)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     std::array<amrex::MultiFab*,3> mf;
     amrex::Periodicity period;
 
@@ -836,6 +840,8 @@ WarpX::FillBoundaryE_avg(int lev, IntVect ng)
 void
 WarpX::FillBoundaryE_avg (int lev, PatchType patch_type, IntVect ng)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     bool const skip_lev0_coarse_patch = true;
 
     if (patch_type == PatchType::fine)
@@ -896,6 +902,8 @@ WarpX::FillBoundaryB_avg (int lev, IntVect ng)
 void
 WarpX::FillBoundaryB_avg (int lev, PatchType patch_type, IntVect ng)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     using ablastr::fields::Direction;
 
     bool const skip_lev0_coarse_patch = true;
@@ -956,6 +964,8 @@ WarpX::FillBoundaryF (int lev, IntVect ng, std::optional<bool> nodal_sync)
 void
 WarpX::FillBoundaryF (int lev, PatchType patch_type, IntVect ng, std::optional<bool> nodal_sync)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     if (patch_type == PatchType::fine)
     {
         if (do_pml && pml[lev] && pml[lev]->ok())
@@ -1008,6 +1018,8 @@ void WarpX::FillBoundaryG (int lev, IntVect ng, std::optional<bool> nodal_sync)
 
 void WarpX::FillBoundaryG (int lev, PatchType patch_type, IntVect ng, std::optional<bool> nodal_sync)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     if (patch_type == PatchType::fine)
     {
         if (do_pml && pml[lev] && pml[lev]->ok())
@@ -1062,6 +1074,8 @@ WarpX::FillBoundaryAux (IntVect ng)
 void
 WarpX::FillBoundaryAux (int lev, IntVect ng)
 {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     ablastr::fields::MultiLevelVectorField Efield_aux = m_fields.get_mr_levels_alldirs(FieldType::Efield_aux, finest_level);
     ablastr::fields::MultiLevelVectorField Bfield_aux = m_fields.get_mr_levels_alldirs(FieldType::Bfield_aux, finest_level);
 
@@ -1080,6 +1094,7 @@ WarpX::SyncCurrent (const std::string& current_fp_string)
     using ablastr::fields::Direction;
 
     WARPX_PROFILE("WarpX::SyncCurrent()");
+    const auto timing = TimeRegion(TimingRegion::communication);
 
     bool const skip_lev0_coarse_patch = true;
 
@@ -1247,6 +1262,8 @@ WarpX::SyncCurrent (const std::string& current_fp_string)
 
 void
 WarpX::SyncRho () {
+    const auto timing = TimeRegion(TimingRegion::communication);
+
     bool const skip_lev0_coarse_patch = true;
     const ablastr::fields::MultiLevelScalarField rho_fp = m_fields.has(FieldType::rho_fp, 0) ?
         m_fields.get_mr_levels(FieldType::rho_fp, finest_level) :
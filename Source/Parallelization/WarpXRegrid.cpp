@@ -8,6 +8,7 @@
  */
 #include "WarpX.H"
 
+#include "BoundaryConditions/CPML.H"
 #include "Diagnostics/MultiDiagnostics.H"
 #include "Diagnostics/ReducedDiags/MultiReducedDiags.H"
 #include "EmbeddedBoundary/Enabled.H"
@@ -57,6 +58,8 @@ using namespace amrex;
 void
 WarpX::CheckLoadBalance (int step)
 {
+    const auto timing = TimeRegion(TimingRegion::load_balance);
+
     if (step > 0 && load_balance_intervals.contains(step+1))
     {
         LoadBalance();
@@ -189,6 +192,8 @@ WarpX::RemakeLevel (int lev, Real /*time*/, const BoxArray& ba, const Distributi
 
         m_fields.remake_level(lev, dm);
 
+        if (lev == 0 && m_cpml) { m_cpml->RemakeDistributionMap(dm); }
+
         // Fine patch
         ablastr::fields::MultiLevelVectorField const& Bfield_fp = m_fields.get_mr_levels_alldirs(FieldType::Bfield_fp, finest_level);
         for (int idim=0; idim < 3; ++idim)
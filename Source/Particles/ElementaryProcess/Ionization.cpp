@@ -34,6 +34,7 @@ IonizationFilterFunc::IonizationFilterFunc (const WarpXParIter& a_pti, int lev,
                                             int a_comp,
                                             int a_atomic_number,
                                             int a_do_adk_correction,
+                                            const ADKRateTableView& a_adk_rate_table,
                                             int a_offset) noexcept:
     m_ionization_energies{a_ionization_energies},
     m_adk_prefactor{a_adk_prefactor},
@@ -43,6 +44,7 @@ IonizationFilterFunc::IonizationFilterFunc (const WarpXParIter& a_pti, int lev,
     comp{a_comp},
     m_atomic_number{a_atomic_number},
     m_do_adk_correction{a_do_adk_correction},
+    m_adk_rate_table{a_adk_rate_table},
     m_Ex_external_particle{E_external_particle[0]},
     m_Ey_external_particle{E_external_particle[1]},
     m_Ez_external_particle{E_external_particle[2]},
@@ -6,6 +6,7 @@
  */
 #include "BreitWheelerEngineWrapper.H"
 
+#include "QedTableParallelGen.H"
 #include "Utils/TextMsg.H"
 
 #include <AMReX.H>
@@ -24,6 +25,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 using namespace std;
@@ -136,6 +138,22 @@ BreitWheelerEngine::get_default_ctrl() const
     };
 }
 
+std::string
+BreitWheelerEngine::get_ctrl_hash (const PicsarBreitWheelerCtrl& ctrl) const
+{
+    auto buf = vector<char>{};
+    //The floating point precision of the tables is part of the hash
+    QedUtils::add_to_hash_buffer(static_cast<uint64_t>(sizeof(amrex::ParticleReal)), buf);
+    QedUtils::add_to_hash_buffer(ctrl.dndt_params.chi_phot_min, buf);
+    QedUtils::add_to_hash_buffer(ctrl.dndt_params.chi_phot_max, buf);
+    QedUtils::add_to_hash_buffer(ctrl.dndt_params.chi_phot_how_many, buf);
+    QedUtils::add_to_hash_buffer(ctrl.pair_prod_params.chi_phot_min, buf);
+    QedUtils::add_to_hash_buffer(ctrl.pair_prod_params.chi_phot_max, buf);
+    QedUtils::add_to_hash_buffer(ctrl.pair_prod_params.chi_phot_how_many, buf);
+    QedUtils::add_to_hash_buffer(ctrl.pair_prod_params.frac_how_many, buf);
+    return QedUtils::hash_buffer_to_string(buf);
+}
+
 amrex::ParticleReal
 BreitWheelerEngine::get_minimum_chi_phot() const
 {
@@ -147,10 +165,18 @@ void BreitWheelerEngine::compute_lookup_tables (
     const amrex::ParticleReal bw_minimum_chi_phot)
 {
 #ifdef WARPX_QED_TABLE_GEN
-    m_dndt_table = BW_dndt_table{ctrl.dndt_params};
-    m_dndt_table.generate(true); //Progress bar is displayed
-    m_pair_prod_table = BW_pair_prod_table{ctrl.pair_prod_params};
-    m_pair_prod_table.generate(true); //Progress bar is displayed
+    //The two sub-tables are generated concurrently on different ranks
+    //(if available) and only then broadcast to all the other ranks
+    const auto dndt_rank = QedUtils::table_generation_rank(0);
+    const auto pair_prod_rank = QedUtils::table_generation_rank(1);
+    auto dndt_data = std::vector<char>{};
+    auto pair_prod_data = std::vector<char>{};
+    m_dndt_table = QedUtils::generate_table_on_rank<BW_dndt_table>(
+        ctrl.dndt_params, dndt_rank, dndt_data);
+    m_pair_prod_table = QedUtils::generate_table_on_rank<BW_pair_prod_table>(
+        ctrl.pair_prod_params, pair_prod_rank, pair_prod_data);
+    QedUtils::bcast_table(m_dndt_table, dndt_data, dndt_rank);
+    QedUtils::bcast_table(m_pair_prod_table, pair_prod_data, pair_prod_rank);
     m_bw_minimum_chi_phot = bw_minimum_chi_phot;
 
     amrex::Gpu::synchronize();
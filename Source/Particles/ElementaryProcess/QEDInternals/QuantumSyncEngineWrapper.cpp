@@ -6,6 +6,7 @@
  */
 #include "QuantumSyncEngineWrapper.H"
 
+#include "QedTableParallelGen.H"
 #include "Utils/TextMsg.H"
 
 #include <AMReX.H>
@@ -24,6 +25,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 using namespace std;
@@ -135,6 +137,23 @@ QuantumSynchrotronEngine::get_default_ctrl() const
     };
 }
 
+std::string
+QuantumSynchrotronEngine::get_ctrl_hash (const PicsarQuantumSyncCtrl& ctrl) const
+{
+    auto buf = vector<char>{};
+    //The floating point precision of the tables is part of the hash
+    QedUtils::add_to_hash_buffer(static_cast<uint64_t>(sizeof(amrex::ParticleReal)), buf);
+    QedUtils::add_to_hash_buffer(ctrl.dndt_params.chi_part_min, buf);
+    QedUtils::add_to_hash_buffer(ctrl.dndt_params.chi_part_max, buf);
+    QedUtils::add_to_hash_buffer(ctrl.dndt_params.chi_part_how_many, buf);
+    QedUtils::add_to_hash_buffer(ctrl.phot_em_params.chi_part_min, buf);
+    QedUtils::add_to_hash_buffer(ctrl.phot_em_params.chi_part_max, buf);
+    QedUtils::add_to_hash_buffer(ctrl.phot_em_params.chi_part_how_many, buf);
+    QedUtils::add_to_hash_buffer(ctrl.phot_em_params.frac_min, buf);
+    QedUtils::add_to_hash_buffer(ctrl.phot_em_params.frac_how_many, buf);
+    return QedUtils::hash_buffer_to_string(buf);
+}
+
 amrex::ParticleReal
 QuantumSynchrotronEngine::get_minimum_chi_part() const
 {
@@ -146,10 +165,18 @@ void QuantumSynchrotronEngine::compute_lookup_tables (
     const amrex::ParticleReal qs_minimum_chi_part)
 {
 #ifdef WARPX_QED_TABLE_GEN
-    m_dndt_table = QS_dndt_table{ctrl.dndt_params};
-    m_dndt_table.generate(true); //Progress bar is displayed
-    m_phot_em_table = QS_phot_em_table{ctrl.phot_em_params};
-    m_phot_em_table.generate(true); //Progress bar is displayed
+    //The two sub-tables are generated concurrently on different ranks
+    //(if available) and only then broadcast to all the other ranks
+    const auto dndt_rank = QedUtils::table_generation_rank(0);
+    const auto phot_em_rank = QedUtils::table_generation_rank(1);
+    auto dndt_data = std::vector<char>{};
+    auto phot_em_data = std::vector<char>{};
+    m_dndt_table = QedUtils::generate_table_on_rank<QS_dndt_table>(
+        ctrl.dndt_params, dndt_rank, dndt_data);
+    m_phot_em_table = QedUtils::generate_table_on_rank<QS_phot_em_table>(
+        ctrl.phot_em_params, phot_em_rank, phot_em_data);
+    QedUtils::bcast_table(m_dndt_table, dndt_data, dndt_rank);
+    QedUtils::bcast_table(m_phot_em_table, phot_em_data, phot_em_rank);
     m_qs_minimum_chi_part = qs_minimum_chi_part;
 
     amrex::Gpu::synchronize();
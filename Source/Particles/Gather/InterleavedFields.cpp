@@ -0,0 +1,114 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "Particles/Gather/InterleavedFields.H"
+
+#include "Utils/TextMsg.H"
+
+#include <AMReX_Array.H>
+#include <AMReX_Array4.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_GpuLaunch.H>
+#include <AMReX_IntVect.H>
+
+using namespace amrex::literals;
+
+void
+InterleavedFieldBuffer::pack (const amrex::Box& box,
+                              const amrex::FArrayBox& exfab, const amrex::FArrayBox& eyfab,
+                              const amrex::FArrayBox& ezfab, const amrex::FArrayBox& bxfab,
+                              const amrex::FArrayBox& byfab, const amrex::FArrayBox& bzfab)
+{
+    constexpr int num_fields = InterleavedFieldArray::num_fields;
+
+    // The nodal box covers the gather box of all the staggerings
+    m_box = amrex::surroundingNodes(box);
+    m_ncomp = exfab.nComp();
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        eyfab.nComp() == m_ncomp && ezfab.nComp() == m_ncomp &&
+        bxfab.nComp() == m_ncomp && byfab.nComp() == m_ncomp && bzfab.nComp() == m_ncomp,
+        "InterleavedFieldBuffer: all the field components must have the same number of components");
+
+    const int cstride = num_fields*m_ncomp;
+    m_data.resize(m_box.numPts()*cstride);
+
+    const amrex::GpuArray<amrex::Array4<amrex::Real const>, num_fields> arrs{
+        exfab.const_array(), eyfab.const_array(), ezfab.const_array(),
+        bxfab.const_array(), byfab.const_array(), bzfab.const_array()};
+    const amrex::GpuArray<amrex::Box, num_fields> boxes{
+        exfab.box(), eyfab.box(), ezfab.box(), bxfab.box(), byfab.box(), bzfab.box()};
+
+    const int ncomp = m_ncomp;
+    const auto lo = amrex::lbound(m_box);
+    const auto len = amrex::length(m_box);
+    amrex::Real* const AMREX_RESTRICT data = m_data.dataPtr();
+
+    amrex::ParallelFor(m_box, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        const amrex::Long cell = (i - lo.x) + (j - lo.y)*static_cast<amrex::Long>(len.x)
+            + (k - lo.z)*static_cast<amrex::Long>(len.x)*len.y;
+        const amrex::IntVect iv(AMREX_D_DECL(i, j, k));
+        for (int n = 0; n < ncomp; ++n) {
+            for (int f = 0; f < num_fields; ++f) {
+                // Points of the nodal box that are not part of a staggered field
+                // are never used by the gather
+                data[cell*cstride + n*num_fields + f] =
+                    boxes[f].contains(iv) ? arrs[f](i, j, k, n) : 0._rt;
+            }
+        }
+    });
+}
+
+InterleavedFieldArray
+InterleavedFieldBuffer::array (int field) const noexcept
+{
+    const auto len = amrex::length(m_box);
+    InterleavedFieldArray arr;
+    arr.p = m_data.dataPtr();
+    arr.begin = amrex::lbound(m_box);
+    arr.jstride = len.x;
+    arr.kstride = static_cast<amrex::Long>(len.x)*len.y;
+    arr.cstride = InterleavedFieldArray::num_fields*m_ncomp;
+    arr.field = field;
+    return arr;
+}
+
+void
+InterleavedFieldCache::NewGeneration (int lev)
+{
+    const amrex::Long generation = ++m_generation[lev];
+
+    // Release the buffers of the tiles that are not used anymore (e.g. after load balancing)
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->first[0] == lev && it->second.generation < generation - 1) { it = m_entries.erase(it); }
+        else { ++it; }
+    }
+}
+
+const InterleavedFieldBuffer&
+InterleavedFieldCache::GetOrPack (
+    int lev, int gather_lev, int grid, int tile, const amrex::Box& box,
+    const amrex::FArrayBox& exfab, const amrex::FArrayBox& eyfab,
+    const amrex::FArrayBox& ezfab, const amrex::FArrayBox& bxfab,
+    const amrex::FArrayBox& byfab, const amrex::FArrayBox& bzfab)
+{
+    Entry* entry = nullptr;
+    amrex::Long generation = 0;
+#ifdef AMREX_USE_OMP
+#pragma omp critical (interleaved_field_cache)
+#endif
+    {
+        // Insertion in a std::map does not invalidate the pointers to the other entries
+        entry = &m_entries[TileKey{lev, gather_lev, grid, tile}];
+        generation = m_generation[lev];
+    }
+
+    if (entry->generation != generation || entry->buffer.box() != amrex::surroundingNodes(box)) {
+        entry->buffer.pack(box, exfab, eyfab, ezfab, bxfab, byfab, bzfab);
+        entry->generation = generation;
+    }
+    return entry->buffer;
+}
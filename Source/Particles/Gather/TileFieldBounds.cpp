@@ -0,0 +1,74 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "Particles/Gather/TileFieldBounds.H"
+
+#include "Particles/WarpXParticleContainer.H"
+
+#include <AMReX_Box.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_GpuQualifiers.H>
+#include <AMReX_Reduce.H>
+
+#include <cmath>
+
+using namespace amrex::literals;
+
+namespace
+{
+    amrex::Real
+    getMaxAbs (const amrex::FArrayBox& fab, const amrex::Box& gather_box)
+    {
+        const amrex::Box bx = amrex::convert(gather_box, fab.box().ixType()) & fab.box();
+        return bx.ok() ? fab.maxabs<amrex::RunOn::Device>(bx, 0) : 0._rt;
+    }
+
+    amrex::Real
+    getNorm (const amrex::Vector<amrex::ParticleReal>& v)
+    {
+        return std::sqrt(static_cast<amrex::Real>(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]));
+    }
+}
+
+TileFieldBounds
+getTileFieldBounds (const WarpXParIter& pti,
+                    const amrex::Box& gather_box,
+                    const amrex::FArrayBox& exfab,
+                    const amrex::FArrayBox& eyfab,
+                    const amrex::FArrayBox& ezfab,
+                    const amrex::FArrayBox& bxfab,
+                    const amrex::FArrayBox& byfab,
+                    const amrex::FArrayBox& bzfab,
+                    const amrex::Vector<amrex::ParticleReal>& E_external_particle,
+                    const amrex::Vector<amrex::ParticleReal>& B_external_particle,
+                    long offset, long np)
+{
+    TileFieldBounds bounds;
+
+    const amrex::Real ex = getMaxAbs(exfab, gather_box);
+    const amrex::Real ey = getMaxAbs(eyfab, gather_box);
+    const amrex::Real ez = getMaxAbs(ezfab, gather_box);
+    const amrex::Real bx = getMaxAbs(bxfab, gather_box);
+    const amrex::Real by = getMaxAbs(byfab, gather_box);
+    const amrex::Real bz = getMaxAbs(bzfab, gather_box);
+
+    bounds.E_max = std::sqrt(ex*ex + ey*ey + ez*ez) + getNorm(E_external_particle);
+    bounds.B_max = std::sqrt(bx*bx + by*by + bz*bz) + getNorm(B_external_particle);
+
+    if (np > 0) {
+        const auto& attribs = pti.GetAttribs();
+        const amrex::ParticleReal* AMREX_RESTRICT ux = attribs[PIdx::ux].dataPtr() + offset;
+        const amrex::ParticleReal* AMREX_RESTRICT uy = attribs[PIdx::uy].dataPtr() + offset;
+        const amrex::ParticleReal* AMREX_RESTRICT uz = attribs[PIdx::uz].dataPtr() + offset;
+        const amrex::ParticleReal u2_max = amrex::Reduce::Max<amrex::ParticleReal>(np,
+            [=] AMREX_GPU_DEVICE (long i) noexcept {
+                return ux[i]*ux[i] + uy[i]*uy[i] + uz[i]*uz[i];
+            });
+        bounds.u_max = std::sqrt(u2_max);
+    }
+
+    return bounds;
+}
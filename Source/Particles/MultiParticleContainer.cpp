@@ -32,6 +32,7 @@
 #include "Particles/PhotonParticleContainer.H"
 #include "Particles/PhysicalParticleContainer.H"
 #include "Particles/RigidInjectedParticleContainer.H"
+#include "Particles/TileMajorIter.H"
 #include "Particles/WarpXParticleContainer.H"
 #include "SpeciesPhysicalProperties.H"
 #include "Utils/Parser/ParserUtils.H"
@@ -72,7 +73,12 @@
 #include <AMReX_Utility.H>
 #include <AMReX_Vector.H>
 
+#ifdef AMREX_USE_OMP
+#   include <omp.h>
+#endif
+
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <map>
@@ -90,6 +96,54 @@ namespace
     {
         Array4< amrex::Real const > Ex, Ey, Ez, Bx, By, Bz;
     };
+
+#ifdef WARPX_QED
+    /**
+     * Reads a QED lookup table from the on-disk cache, if available,
+     * and broadcasts it to all the ranks.
+     *
+     * @param[in] cache_file name of the cached table (empty if caching is disabled)
+     * @param[out] table_data the raw table data
+     * @return true if the table has been found in the cache
+     */
+    bool ReadCachedQEDTable (const std::string& cache_file, Vector<char>& table_data)
+    {
+        if (cache_file.empty()) { return false; }
+
+        int found = 0;
+        if (ParallelDescriptor::IOProcessor()) {
+            found = static_cast<int>(amrex::FileExists(cache_file));
+        }
+        ParallelDescriptor::Bcast(&found, 1, ParallelDescriptor::IOProcessorNumber());
+        if (found == 0) { return false; }
+
+        ParallelDescriptor::ReadAndBcastFile(cache_file, table_data);
+        return true;
+    }
+
+    /**
+     * Writes a QED lookup table on disk (only the I/O processor writes).
+     *
+     * @param[in] table_data the raw table data
+     * @param[in] table_name name of the output file (skipped if empty)
+     * @param[in] cache_dir directory of the on-disk cache
+     * @param[in] cache_file name of the cached table (skipped if empty)
+     */
+    void WriteQEDTable (const Vector<char>& table_data,
+        const std::string& table_name,
+        const std::string& cache_dir, const std::string& cache_file)
+    {
+        if (!ParallelDescriptor::IOProcessor()) { return; }
+
+        if (!table_name.empty()){
+            WarpXUtilIO::WriteBinaryDataOnFile(table_name, table_data);
+        }
+        if (!cache_file.empty()){
+            amrex::UtilCreateDirectory(cache_dir, 0755);
+            WarpXUtilIO::WriteBinaryDataOnFile(cache_file, table_data);
+        }
+    }
+#endif
 }
 
 MultiParticleContainer::MultiParticleContainer (AmrCore* amr_core)
@@ -324,6 +378,13 @@ MultiParticleContainer::ReadParameters ()
             }
 
         }
+        utils::parser::queryWithParser(
+            pp_particles, "redistribute_neighbor_halo", m_redistribute_neighbor_halo);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_redistribute_neighbor_halo >= 0,
+            "particles.redistribute_neighbor_halo must be non-negative");
+
+        pp_particles.query("tile_major", m_tile_major);
+
         pp_particles.query("use_fdtd_nci_corr", WarpX::use_fdtd_nci_corr);
 #ifdef WARPX_DIM_RZ
         WARPX_ALWAYS_ASSERT_WITH_MESSAGE(WarpX::use_fdtd_nci_corr==0,
@@ -476,8 +537,106 @@ MultiParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
         if (fields.has(FieldType::rho_fp, lev)) { fields.get(FieldType::rho_fp, lev)->setVal(0.0); }
         if (fields.has(FieldType::rho_buf, lev)) { fields.get(FieldType::rho_buf, lev)->setVal(0.0); }
     }
-    for (auto& pc : allcontainers) {
-        pc->Evolve(fields, lev, current_fp_string, t, dt, a_dt_type, skip_deposition, push_type);
+    // The fields have changed since the previous call: the shared field buffers must be refilled
+    if (WarpX::field_gathering_shared_buffers) {
+        m_interleaved_field_cache.NewGeneration(lev);
+        for (auto& pc : allcontainers) { pc->SetInterleavedFieldCache(&m_interleaved_field_cache); }
+    }
+
+#ifdef AMREX_USE_GPU
+    // On GPU, the tiles are processed one at a time by the whole device: there is no cache to reuse
+    const bool tile_major = false;
+#else
+    const bool tile_major = m_tile_major;
+#endif
+    if (tile_major) {
+        EvolveTileMajor(fields, lev, current_fp_string, t, dt, a_dt_type, skip_deposition, push_type);
+    } else {
+        for (auto& pc : allcontainers) {
+            pc->Evolve(fields, lev, current_fp_string, t, dt, a_dt_type, skip_deposition, push_type);
+        }
+    }
+
+    if (WarpX::field_gathering_shared_buffers) {
+        for (auto& pc : allcontainers) { pc->SetInterleavedFieldCache(nullptr); }
+    }
+}
+
+void
+MultiParticleContainer::EvolveTileMajor (ablastr::fields::MultiFabRegister& fields,
+                                         int lev,
+                                         std::string const& current_fp_string,
+                                         Real t, Real dt, DtType a_dt_type, bool skip_deposition,
+                                         PushType push_type)
+{
+    WARPX_PROFILE("MultiParticleContainer::EvolveTileMajor()");
+
+    using ablastr::fields::Direction;
+
+    // The ionization and QED processes create their product particles before the push
+    // (see WarpX::OneStep), so the species are independent from each other here and
+    // can be evolved in any order. The lasers, and the species that use super-cycling
+    // or sub-cycling (which have their own time loop), are evolved species by species.
+    auto const nspecies = static_cast<int>(species_names.size());
+    amrex::Vector<PhysicalParticleContainer*> species;
+    amrex::Vector<WarpXParticleContainer*> containers;
+    for (int i = 0; i < nContainers(); ++i) {
+        auto& pc = allcontainers[i];
+        if (i < nspecies && pc->getPushInterval() == 1 && pc->getPushSubsteps() == 1) {
+            species.push_back(static_cast<PhysicalParticleContainer*>(pc.get()));
+            containers.push_back(pc.get());
+        } else {
+            pc->Evolve(fields, lev, current_fp_string, t, dt, a_dt_type, skip_deposition, push_type);
+        }
+    }
+    if (species.empty()) { return; }
+
+    for (auto* pc : species) {
+        pc->EvolveBegin(lev, dt);
+    }
+
+    amrex::MultiFab* jx = nullptr;
+    amrex::MultiFab* jy = nullptr;
+    amrex::MultiFab* jz = nullptr;
+    if (!skip_deposition) {
+        jx = fields.get(current_fp_string, Direction{0}, lev);
+        jy = fields.get(current_fp_string, Direction{1}, lev);
+        jz = fields.get(current_fp_string, Direction{2}, lev);
+        AttachSharedTileCurrent(containers);
+    }
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+    {
+#ifdef AMREX_USE_OMP
+        const int thread_num = omp_get_thread_num();
+#else
+        const int thread_num = 0;
+#endif
+
+        std::array<amrex::FArrayBox, 6> filtered_fields;
+
+        for (TileMajorIter tmi(containers, lev); tmi.isValid(); ++tmi)
+        {
+            if (!skip_deposition) { ZeroSharedTileCurrent(thread_num, tmi.tilebox(), *jx, *jy, *jz); }
+
+            for (int i = 0; i < tmi.numSpecies(); ++i)
+            {
+                WarpXParIter* pti = tmi.species(i);
+                if (pti == nullptr) { continue; }
+                species[i]->EvolveTile(*pti, fields, lev, current_fp_string, dt, a_dt_type,
+                                       skip_deposition, push_type, thread_num, filtered_fields);
+            }
+
+            if (!skip_deposition) { AddSharedTileCurrent(thread_num, tmi.index(), *jx, *jy, *jz); }
+        }
+    }
+
+    if (!skip_deposition) { DetachSharedTileCurrent(containers); }
+
+    for (auto* pc : species) {
+        pc->EvolveEnd(lev, a_dt_type);
     }
 }
 
@@ -538,9 +697,19 @@ MultiParticleContainer::DepositCurrent (
     }
 
     // Call the deposition kernel for each species
-    for (auto& pc : allcontainers)
-    {
-        pc->DepositCurrent(J, dt, relative_time);
+#ifdef AMREX_USE_GPU
+    // On GPU, the particles deposit directly in J, without tile-local buffers
+    const bool tile_major = false;
+#else
+    const bool tile_major = m_tile_major;
+#endif
+    if (tile_major) {
+        DepositCurrentTileMajor(J, dt, relative_time);
+    } else {
+        for (auto& pc : allcontainers)
+        {
+            pc->DepositCurrent(J, dt, relative_time);
+        }
     }
 
 #ifdef WARPX_DIM_RZ
@@ -552,6 +721,119 @@ MultiParticleContainer::DepositCurrent (
 #endif
 }
 
+void
+MultiParticleContainer::DepositCurrentTileMajor (
+    ablastr::fields::MultiLevelVectorField const & J,
+    const amrex::Real dt, const amrex::Real relative_time)
+{
+    WARPX_PROFILE("MultiParticleContainer::DepositCurrentTileMajor()");
+
+    amrex::Vector<WarpXParticleContainer*> containers;
+    for (auto& pc : allcontainers) {
+        containers.push_back(pc.get());
+    }
+
+    AttachSharedTileCurrent(containers);
+
+    for (int lev = 0; lev < static_cast<int>(J.size()); ++lev)
+    {
+        amrex::MultiFab* jx = J[lev][0];
+        amrex::MultiFab* jy = J[lev][1];
+        amrex::MultiFab* jz = J[lev][2];
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+        {
+#ifdef AMREX_USE_OMP
+            const int thread_num = omp_get_thread_num();
+#else
+            const int thread_num = 0;
+#endif
+            for (TileMajorIter tmi(containers, lev); tmi.isValid(); ++tmi)
+            {
+                // The buffers are zeroed once for all the species of this tile
+                ZeroSharedTileCurrent(thread_num, tmi.tilebox(), *jx, *jy, *jz);
+
+                for (int i = 0; i < tmi.numSpecies(); ++i)
+                {
+                    WarpXParIter* pti = tmi.species(i);
+                    if (pti == nullptr) { continue; }
+                    containers[i]->DepositCurrentInTile(*pti, jx, jy, jz,
+                                                        thread_num, lev, dt, relative_time);
+                }
+
+                // ... and added to J once
+                AddSharedTileCurrent(thread_num, tmi.index(), *jx, *jy, *jz);
+            }
+        }
+    }
+
+    DetachSharedTileCurrent(containers);
+}
+
+void
+MultiParticleContainer::AttachSharedTileCurrent (const amrex::Vector<WarpXParticleContainer*>& containers)
+{
+#ifdef AMREX_USE_OMP
+    int num_threads = 1;
+#pragma omp parallel
+#pragma omp single
+    num_threads = omp_get_num_threads();
+#else
+    const int num_threads = 1;
+#endif
+    m_shared_tile_current.jx.resize(num_threads);
+    m_shared_tile_current.jy.resize(num_threads);
+    m_shared_tile_current.jz.resize(num_threads);
+    for (auto* pc : containers) {
+        pc->SetSharedTileCurrent(&m_shared_tile_current);
+    }
+}
+
+void
+MultiParticleContainer::DetachSharedTileCurrent (const amrex::Vector<WarpXParticleContainer*>& containers)
+{
+    for (auto* pc : containers) {
+        pc->SetSharedTileCurrent(nullptr);
+    }
+}
+
+void
+MultiParticleContainer::ZeroSharedTileCurrent (int thread_num, const amrex::Box& tilebox,
+                                               const amrex::MultiFab& jx, const amrex::MultiFab& jy,
+                                               const amrex::MultiFab& jz)
+{
+    const amrex::IntVect& ng_J = WarpX::GetInstance().get_ng_depos_J();
+
+    // Same staggered tile boxes as in WarpXParticleContainer::DepositCurrent
+    const Box tbx = amrex::grow(amrex::convert(tilebox, jx.ixType().toIntVect()), ng_J);
+    const Box tby = amrex::grow(amrex::convert(tilebox, jy.ixType().toIntVect()), ng_J);
+    const Box tbz = amrex::grow(amrex::convert(tilebox, jz.ixType().toIntVect()), ng_J);
+
+    auto& jx_fab = m_shared_tile_current.jx[thread_num];
+    auto& jy_fab = m_shared_tile_current.jy[thread_num];
+    auto& jz_fab = m_shared_tile_current.jz[thread_num];
+    jx_fab.resize(tbx, jx.nComp());
+    jy_fab.resize(tby, jy.nComp());
+    jz_fab.resize(tbz, jz.nComp());
+    jx_fab.setVal(0.0);
+    jy_fab.setVal(0.0);
+    jz_fab.setVal(0.0);
+}
+
+void
+MultiParticleContainer::AddSharedTileCurrent (int thread_num, int grid,
+                                              amrex::MultiFab& jx, amrex::MultiFab& jy, amrex::MultiFab& jz)
+{
+    const auto& jx_fab = m_shared_tile_current.jx[thread_num];
+    const auto& jy_fab = m_shared_tile_current.jy[thread_num];
+    const auto& jz_fab = m_shared_tile_current.jz[thread_num];
+    jx[grid].lockAdd(jx_fab, jx_fab.box(), jx_fab.box(), 0, 0, jx.nComp());
+    jy[grid].lockAdd(jy_fab, jy_fab.box(), jy_fab.box(), 0, 0, jy.nComp());
+    jz[grid].lockAdd(jz_fab, jz_fab.box(), jz_fab.box(), 0, 0, jz.nComp());
+}
+
 void
 MultiParticleContainer::DepositCharge (
     const ablastr::fields::MultiLevelScalarField& rho,
@@ -617,6 +899,8 @@ MultiParticleContainer::SortParticlesByBin (amrex::IntVect bin_size)
     for (auto& pc : allcontainers) {
         if (WarpX::sort_particles_for_deposition) {
             pc->SortParticlesForDeposition(WarpX::sort_idx_type);
+        } else if (WarpX::sort_bin_order == SortBinOrder::morton) {
+            pc->SortParticlesByMortonBin(bin_size);
         } else {
             pc->SortParticlesByBin(bin_size);
         }
@@ -626,8 +910,11 @@ MultiParticleContainer::SortParticlesByBin (amrex::IntVect bin_size)
 void
 MultiParticleContainer::Redistribute ()
 {
-    for (auto& pc : allcontainers) {
+    for (int i = 0; i < nContainers(); ++i) {
+        auto& pc = allcontainers[i];
+        m_tile_pool.BeforeRedistribute(*pc, i);
         pc->Redistribute();
+        m_tile_pool.AfterRedistribute(*pc, i);
     }
 }
 
@@ -650,8 +937,27 @@ MultiParticleContainer::deleteInvalidParticles ()
 void
 MultiParticleContainer::RedistributeLocal (const int num_ghost)
 {
-    for (auto& pc : allcontainers) {
+    for (int i = 0; i < nContainers(); ++i) {
+        auto& pc = allcontainers[i];
+        m_tile_pool.BeforeRedistribute(*pc, i);
         pc->Redistribute(0, 0, 0, num_ghost);
+        m_tile_pool.AfterRedistribute(*pc, i);
+    }
+}
+
+void
+MultiParticleContainer::RedistributeNeighborOrGlobal (const int num_ghost)
+{
+    bool within_halo = true;
+    for (auto& pc : allcontainers) {
+        within_halo = within_halo && pc->ParticlesWithinGridGhostCells(num_ghost);
+    }
+    ParallelDescriptor::ReduceBoolAnd(within_halo);
+
+    if (within_halo) {
+        RedistributeLocal(num_ghost);
+    } else {
+        Redistribute();
     }
 }
 
@@ -908,6 +1214,13 @@ MultiParticleContainer::doFieldIonization (int lev,
             }
             auto wt = static_cast<amrex::Real>(amrex::second());
 
+            // Skip the tiles where no particle can be ionized
+            if (phys_pc_ptr->isTileBelowIonizationThreshold(pti, lev, Ex.nGrowVect(),
+                                                            Ex[pti], Ey[pti], Ez[pti],
+                                                            Bx[pti], By[pti], Bz[pti])) {
+                continue;
+            }
+
             auto& src_tile = pc_source ->ParticlesAt(lev, pti);
             auto& dst_tile = pc_product->ParticlesAt(lev, pti);
 
@@ -1137,9 +1450,11 @@ MultiParticleContainer::QuantumSyncGenerateTable ()
     const ParmParse pp_qed_qs("qed_qs");
     std::string table_name;
     pp_qed_qs.query("save_table_in", table_name);
+    std::string cache_dir;
+    pp_qed_qs.query("table_cache_dir", cache_dir);
     WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
-        !table_name.empty(),
-        "qed_qs.save_table_in should be provided!");
+        !table_name.empty() || !cache_dir.empty(),
+        "qed_qs.save_table_in or qed_qs.table_cache_dir should be provided!");
 
     // qs_minimum_chi_part is the minimum chi parameter to be
     // considered for Synchrotron emission. If a lepton has chi < chi_min,
@@ -1147,78 +1462,83 @@ MultiParticleContainer::QuantumSyncGenerateTable ()
     amrex::Real qs_minimum_chi_part;
     utils::parser::getWithParser(pp_qed_qs, "chi_min", qs_minimum_chi_part);
 
-    if(ParallelDescriptor::IOProcessor()){
-        PicsarQuantumSyncCtrl ctrl;
-
-        //==Table parameters==
-
-        //--- sub-table 1 (1D)
-        //These parameters are used to pre-compute a function
-        //which appears in the evolution of the optical depth
-
-        //Minimun chi for the table. If a lepton has chi < tab_dndt_chi_min,
-        //chi is considered as if it were equal to tab_dndt_chi_min
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_dndt_chi_min", ctrl.dndt_params.chi_part_min);
-
-        //Maximum chi for the table. If a lepton has chi > tab_dndt_chi_max,
-        //chi is considered as if it were equal to tab_dndt_chi_max
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_dndt_chi_max", ctrl.dndt_params.chi_part_max);
-
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_dndt_how_many", ctrl.dndt_params.chi_part_how_many);
-        //------
-
-        //--- sub-table 2 (2D)
-        //These parameters are used to pre-compute a function
-        //which is used to extract the properties of the generated
-        //photons.
-
-        //Minimun chi for the table. If a lepton has chi < tab_em_chi_min,
-        //chi is considered as if it were equal to tab_em_chi_min
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_chi_min", ctrl.phot_em_params.chi_part_min);
-
-        //Maximum chi for the table. If a lepton has chi > tab_em_chi_max,
-        //chi is considered as if it were equal to tab_em_chi_max
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_chi_max", ctrl.phot_em_params.chi_part_max);
-
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_chi_how_many", ctrl.phot_em_params.chi_part_how_many);
-
-        //The other axis of the table is the ratio between the quantum
-        //parameter of the emitted photon and the quantum parameter of the
-        //lepton. This parameter is the minimum ratio to consider for the table.
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_frac_min", ctrl.phot_em_params.frac_min);
-
-        //This parameter is the number of different points to consider for the second
-        //axis
-        utils::parser::getWithParser(
-            pp_qed_qs, "tab_em_frac_how_many", ctrl.phot_em_params.frac_how_many);
-        //====================
+    PicsarQuantumSyncCtrl ctrl;
+
+    //==Table parameters==
+
+    //--- sub-table 1 (1D)
+    //These parameters are used to pre-compute a function
+    //which appears in the evolution of the optical depth
+
+    //Minimun chi for the table. If a lepton has chi < tab_dndt_chi_min,
+    //chi is considered as if it were equal to tab_dndt_chi_min
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_dndt_chi_min", ctrl.dndt_params.chi_part_min);
+
+    //Maximum chi for the table. If a lepton has chi > tab_dndt_chi_max,
+    //chi is considered as if it were equal to tab_dndt_chi_max
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_dndt_chi_max", ctrl.dndt_params.chi_part_max);
+
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_dndt_how_many", ctrl.dndt_params.chi_part_how_many);
+    //------
+
+    //--- sub-table 2 (2D)
+    //These parameters are used to pre-compute a function
+    //which is used to extract the properties of the generated
+    //photons.
+
+    //Minimun chi for the table. If a lepton has chi < tab_em_chi_min,
+    //chi is considered as if it were equal to tab_em_chi_min
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_chi_min", ctrl.phot_em_params.chi_part_min);
+
+    //Maximum chi for the table. If a lepton has chi > tab_em_chi_max,
+    //chi is considered as if it were equal to tab_em_chi_max
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_chi_max", ctrl.phot_em_params.chi_part_max);
+
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_chi_how_many", ctrl.phot_em_params.chi_part_how_many);
+
+    //The other axis of the table is the ratio between the quantum
+    //parameter of the emitted photon and the quantum parameter of the
+    //lepton. This parameter is the minimum ratio to consider for the table.
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_frac_min", ctrl.phot_em_params.frac_min);
+
+    //This parameter is the number of different points to consider for the second
+    //axis
+    utils::parser::getWithParser(
+        pp_qed_qs, "tab_em_frac_how_many", ctrl.phot_em_params.frac_how_many);
+    //====================
+
+    // Generated tables are cached on disk,
+    // using a hash of the control parameters as a key
+    const auto cache_file = cache_dir.empty() ? std::string{} :
+        cache_dir + "/qs_table_" + m_shr_p_qs_engine->get_ctrl_hash(ctrl) + ".bin";
 
+    Vector<char> table_data;
+    if (ReadCachedQEDTable(cache_file, table_data)){
+        ablastr::warn_manager::WMRecordWarning("QED",
+            "The Quantum Synchrotron table has been read from the cache: " + cache_file,
+            ablastr::warn_manager::WarnPriority::low);
+        m_shr_p_qs_engine->init_lookup_tables_from_raw_data(
+            table_data, qs_minimum_chi_part);
+        WriteQEDTable(table_data, table_name, cache_dir, std::string{});
+    }
+    else{
+        //All the ranks take part in the generation of the table
         m_shr_p_qs_engine->compute_lookup_tables(ctrl, qs_minimum_chi_part);
         const auto data = m_shr_p_qs_engine->export_lookup_tables_data();
-        WarpXUtilIO::WriteBinaryDataOnFile(table_name,
-            Vector<char>{data.begin(), data.end()});
+        WriteQEDTable(Vector<char>{data.begin(), data.end()},
+            table_name, cache_dir, cache_file);
     }
 
     ParallelDescriptor::Barrier();
-    Vector<char> table_data;
-    ParallelDescriptor::ReadAndBcastFile(table_name, table_data);
-    ParallelDescriptor::Barrier();
-
-    //No need to initialize from raw data for the processor that
-    //has just generated the table
-    if(!ParallelDescriptor::IOProcessor()){
-        m_shr_p_qs_engine->init_lookup_tables_from_raw_data(
-            table_data, qs_minimum_chi_part);
-    }
 }
 
 void
@@ -1227,9 +1547,11 @@ MultiParticleContainer::BreitWheelerGenerateTable ()
     const ParmParse pp_qed_bw("qed_bw");
     std::string table_name;
     pp_qed_bw.query("save_table_in", table_name);
+    std::string cache_dir;
+    pp_qed_bw.query("table_cache_dir", cache_dir);
     WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
-        !table_name.empty(),
-        "qed_bw.save_table_in should be provided!");
+        !table_name.empty() || !cache_dir.empty(),
+        "qed_bw.save_table_in or qed_bw.table_cache_dir should be provided!");
 
     // bw_minimum_chi_phot is the minimum chi parameter to be
     // considered for pair production. If a photon has chi < chi_min,
@@ -1237,73 +1559,78 @@ MultiParticleContainer::BreitWheelerGenerateTable ()
     amrex::Real bw_minimum_chi_part;
     utils::parser::getWithParser(pp_qed_bw, "chi_min", bw_minimum_chi_part);
 
-    if(ParallelDescriptor::IOProcessor()){
-        PicsarBreitWheelerCtrl ctrl;
+    PicsarBreitWheelerCtrl ctrl;
 
-        //==Table parameters==
+    //==Table parameters==
 
-        //--- sub-table 1 (1D)
-        //These parameters are used to pre-compute a function
-        //which appears in the evolution of the optical depth
+    //--- sub-table 1 (1D)
+    //These parameters are used to pre-compute a function
+    //which appears in the evolution of the optical depth
 
-        //Minimun chi for the table. If a photon has chi < tab_dndt_chi_min,
-        //an analytical approximation is used.
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_dndt_chi_min", ctrl.dndt_params.chi_phot_min);
+    //Minimun chi for the table. If a photon has chi < tab_dndt_chi_min,
+    //an analytical approximation is used.
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_dndt_chi_min", ctrl.dndt_params.chi_phot_min);
 
-        //Maximum chi for the table. If a photon has chi > tab_dndt_chi_max,
-        //an analytical approximation is used.
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_dndt_chi_max", ctrl.dndt_params.chi_phot_max);
+    //Maximum chi for the table. If a photon has chi > tab_dndt_chi_max,
+    //an analytical approximation is used.
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_dndt_chi_max", ctrl.dndt_params.chi_phot_max);
 
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_dndt_how_many", ctrl.dndt_params.chi_phot_how_many);
-        //------
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_dndt_how_many", ctrl.dndt_params.chi_phot_how_many);
+    //------
 
-        //--- sub-table 2 (2D)
-        //These parameters are used to pre-compute a function
-        //which is used to extract the properties of the generated
-        //particles.
+    //--- sub-table 2 (2D)
+    //These parameters are used to pre-compute a function
+    //which is used to extract the properties of the generated
+    //particles.
 
-        //Minimun chi for the table. If a photon has chi < tab_pair_chi_min
-        //chi is considered as it were equal to chi_phot_tpair_min
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_chi_min", ctrl.pair_prod_params.chi_phot_min);
+    //Minimun chi for the table. If a photon has chi < tab_pair_chi_min
+    //chi is considered as it were equal to chi_phot_tpair_min
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_chi_min", ctrl.pair_prod_params.chi_phot_min);
 
-        //Maximum chi for the table. If a photon has chi > tab_pair_chi_max
-        //chi is considered as it were equal to chi_phot_tpair_max
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_chi_max", ctrl.pair_prod_params.chi_phot_max);
+    //Maximum chi for the table. If a photon has chi > tab_pair_chi_max
+    //chi is considered as it were equal to chi_phot_tpair_max
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_chi_max", ctrl.pair_prod_params.chi_phot_max);
 
-        //How many points should be used for chi in the table
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_chi_how_many", ctrl.pair_prod_params.chi_phot_how_many);
+    //How many points should be used for chi in the table
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_chi_how_many", ctrl.pair_prod_params.chi_phot_how_many);
 
-        //The other axis of the table is the fraction of the initial energy
-        //'taken away' by the most energetic particle of the pair.
-        //This parameter is the number of different fractions to consider
-        utils::parser::getWithParser(
-            pp_qed_bw, "tab_pair_frac_how_many", ctrl.pair_prod_params.frac_how_many);
-        //====================
+    //The other axis of the table is the fraction of the initial energy
+    //'taken away' by the most energetic particle of the pair.
+    //This parameter is the number of different fractions to consider
+    utils::parser::getWithParser(
+        pp_qed_bw, "tab_pair_frac_how_many", ctrl.pair_prod_params.frac_how_many);
+    //====================
 
-        m_shr_p_bw_engine->compute_lookup_tables(ctrl, bw_minimum_chi_part);
-        const auto data = m_shr_p_bw_engine->export_lookup_tables_data();
-        WarpXUtilIO::WriteBinaryDataOnFile(table_name,
-            Vector<char>{data.begin(), data.end()});
-    }
+    // Generated tables are cached on disk,
+    // using a hash of the control parameters as a key
+    const auto cache_file = cache_dir.empty() ? std::string{} :
+        cache_dir + "/bw_table_" + m_shr_p_bw_engine->get_ctrl_hash(ctrl) + ".bin";
 
-    ParallelDescriptor::Barrier();
     Vector<char> table_data;
-    ParallelDescriptor::ReadAndBcastFile(table_name, table_data);
-    ParallelDescriptor::Barrier();
-
-    //No need to initialize from raw data for the processor that
-    //has just generated the table
-    if(!ParallelDescriptor::IOProcessor()){
+    if (ReadCachedQEDTable(cache_file, table_data)){
+        ablastr::warn_manager::WMRecordWarning("QED",
+            "The Breit Wheeler table has been read from the cache: " + cache_file,
+            ablastr::warn_manager::WarnPriority::low);
         m_shr_p_bw_engine->init_lookup_tables_from_raw_data(
             table_data, bw_minimum_chi_part);
+        WriteQEDTable(table_data, table_name, cache_dir, std::string{});
     }
+    else{
+        //All the ranks take part in the generation of the table
+        m_shr_p_bw_engine->compute_lookup_tables(ctrl, bw_minimum_chi_part);
+        const auto data = m_shr_p_bw_engine->export_lookup_tables_data();
+        WriteQEDTable(Vector<char>{data.begin(), data.end()},
+            table_name, cache_dir, cache_file);
+    }
+
+    ParallelDescriptor::Barrier();
 }
 
 void
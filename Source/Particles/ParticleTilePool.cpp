@@ -0,0 +1,198 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "ParticleTilePool.H"
+
+#include "MultiParticleContainer.H"
+#include "Utils/Parser/ParserUtils.H"
+#include "Utils/TextMsg.H"
+#include "WarpXParticleContainer.H"
+
+#include <AMReX_ParmParse.H>
+#include <AMReX_ParticleTile.H>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <set>
+
+namespace
+{
+    /** Number of bytes used by one particle of a tile */
+    template <typename SoA>
+    amrex::Long BytesPerParticle (const SoA& soa)
+    {
+        return static_cast<amrex::Long>(sizeof(std::uint64_t))
+            + soa.NumRealComps()*static_cast<amrex::Long>(sizeof(amrex::ParticleReal))
+            + soa.NumIntComps()*static_cast<amrex::Long>(sizeof(int));
+    }
+
+    /** Reserves new_capacity particles in all the components of a tile */
+    template <typename SoA>
+    void GrowComponents (SoA& soa, amrex::Long new_capacity)
+    {
+        soa.GetIdCPUData().reserve(new_capacity);
+        for (int comp = 0; comp < soa.NumRealComps(); ++comp) {
+            soa.GetRealData(comp).reserve(new_capacity);
+        }
+        for (int comp = 0; comp < soa.NumIntComps(); ++comp) {
+            soa.GetIntData(comp).reserve(new_capacity);
+        }
+    }
+
+    /** Reduces the capacity of a vector to new_capacity, with a single reallocation */
+    template <typename Vec>
+    void ShrinkVector (Vec& v, amrex::Long new_capacity)
+    {
+        const auto size = v.size();
+        v.resize(new_capacity);
+        v.shrink_to_fit();
+        v.resize(size);
+    }
+
+    /** Reduces the capacity of all the components of a tile to new_capacity */
+    template <typename SoA>
+    void ShrinkComponents (SoA& soa, amrex::Long new_capacity)
+    {
+        ShrinkVector(soa.GetIdCPUData(), new_capacity);
+        for (int comp = 0; comp < soa.NumRealComps(); ++comp) {
+            ShrinkVector(soa.GetRealData(comp), new_capacity);
+        }
+        for (int comp = 0; comp < soa.NumIntComps(); ++comp) {
+            ShrinkVector(soa.GetIntData(comp), new_capacity);
+        }
+    }
+}
+
+ParticleTilePool::ParticleTilePool ()
+{
+    const amrex::ParmParse pp_particles("particles");
+    pp_particles.query("tile_pool", m_enabled);
+    utils::parser::queryWithParser(pp_particles, "tile_pool_slab_size", m_slab_size);
+    utils::parser::queryWithParser(pp_particles, "tile_pool_spare_fraction", m_spare_fraction);
+    utils::parser::queryWithParser(pp_particles, "tile_pool_shrink_delay", m_shrink_delay);
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_slab_size > 0,
+        "particles.tile_pool_slab_size must be positive");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_spare_fraction >= 0,
+        "particles.tile_pool_spare_fraction must be non-negative");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_shrink_delay >= 0,
+        "particles.tile_pool_shrink_delay must be non-negative");
+}
+
+amrex::Long
+ParticleTilePool::CapacityClass (amrex::Long n) const noexcept
+{
+    if (n <= 0) { return 0; }
+
+    // Capacity classes are 1, 2, 3, 4, 6, 8, 12, 16, ... slabs:
+    // powers of two, and 1.5 times powers of two
+    amrex::Long nslabs = 1;
+    while (nslabs*m_slab_size < n) {
+        const bool is_power_of_two = (nslabs & (nslabs - 1)) == 0;
+        if (nslabs == 1) { nslabs = 2; }
+        else if (is_power_of_two) { nslabs += nslabs/2; }
+        else { nslabs = (nslabs/3)*4; }
+    }
+    return nslabs*m_slab_size;
+}
+
+void
+ParticleTilePool::BeforeRedistribute (WarpXParticleContainer& pc, int ispecies)
+{
+    if (!m_enabled) { return; }
+
+    for (int lev = 0; lev <= pc.finestLevel(); ++lev) {
+        for (auto& [index, ptile] : pc.GetParticles(lev)) {
+            auto& soa = ptile.GetStructOfArrays();
+            auto& state = m_tiles[TileKey{ispecies, lev, index.first, index.second}];
+
+            const auto np = static_cast<amrex::Long>(ptile.numParticles());
+            const auto capacity = static_cast<amrex::Long>(soa.GetIdCPUData().capacity());
+            const auto target = CapacityClass(static_cast<amrex::Long>(
+                std::ceil(static_cast<amrex::Real>(np)*(1 + m_spare_fraction))));
+
+            if (capacity < target) {
+                // Grow: leave room for the particles that arrive in this tile
+                GrowComponents(soa, target);
+                state.num_oversized = 0;
+                ++m_num_grow;
+            } else if (2*target < capacity) {
+                // Shrink, but only if the tile has been oversized for a while
+                ++state.num_oversized;
+                if (state.num_oversized > m_shrink_delay) {
+                    ShrinkComponents(soa, target);
+                    state.num_oversized = 0;
+                    ++m_num_shrink;
+                }
+            } else {
+                state.num_oversized = 0;
+            }
+
+            state.capacity = static_cast<amrex::Long>(soa.GetIdCPUData().capacity());
+        }
+    }
+}
+
+void
+ParticleTilePool::AfterRedistribute (const WarpXParticleContainer& pc, int ispecies)
+{
+    if (!m_enabled) { return; }
+
+    std::set<TileKey> existing_tiles;
+    for (int lev = 0; lev <= pc.finestLevel(); ++lev) {
+        for (const auto& [index, ptile] : pc.GetParticles(lev)) {
+            const auto key = TileKey{ispecies, lev, index.first, index.second};
+            existing_tiles.insert(key);
+
+            const auto capacity = static_cast<amrex::Long>(
+                ptile.GetStructOfArrays().GetIdCPUData().capacity());
+            auto& state = m_tiles[key];
+            if (capacity != state.capacity) {
+                ++m_num_realloc;
+                state.capacity = capacity;
+            }
+        }
+    }
+
+    // Forget the tiles that were removed by Redistribute
+    constexpr int imin = std::numeric_limits<int>::lowest();
+    constexpr int imax = std::numeric_limits<int>::max();
+    auto it = m_tiles.lower_bound(TileKey{ispecies, imin, imin, imin});
+    const auto end = m_tiles.upper_bound(TileKey{ispecies, imax, imax, imax});
+    while (it != end) {
+        if (existing_tiles.count(it->first) == 0) { it = m_tiles.erase(it); }
+        else { ++it; }
+    }
+}
+
+ParticleTilePool::Stats
+ParticleTilePool::GetStats (const MultiParticleContainer& mypc) const
+{
+    Stats stats;
+    for (int ispecies = 0; ispecies < mypc.nContainers(); ++ispecies) {
+        const auto& pc = mypc.GetParticleContainer(ispecies);
+        for (int lev = 0; lev <= pc.finestLevel(); ++lev) {
+            for (const auto& kv : pc.GetParticles(lev)) {
+                const auto& soa = kv.second.GetStructOfArrays();
+                const auto np = static_cast<amrex::Long>(kv.second.numParticles());
+                const auto capacity = static_cast<amrex::Long>(soa.GetIdCPUData().capacity());
+                const auto bytes_per_particle = BytesPerParticle(soa);
+
+                ++stats.num_tiles;
+                stats.num_particles += np;
+                stats.capacity += capacity;
+                stats.bytes_used += np*bytes_per_particle;
+                stats.bytes_reserved += capacity*bytes_per_particle;
+            }
+        }
+    }
+    stats.num_grow = m_num_grow;
+    stats.num_shrink = m_num_shrink;
+    stats.num_realloc = m_num_realloc;
+    return stats;
+}
@@ -12,6 +12,7 @@
 #endif
 #include "Particles/Gather/FieldGather.H"
 #include "Particles/Gather/GetExternalFields.H"
+#include "Particles/Gather/TileFieldBounds.H"
 #include "Particles/PhysicalParticleContainer.H"
 #include "Particles/Pusher/CopyParticleAttribs.H"
 #include "Particles/Pusher/GetAndSetPosition.H"
@@ -119,7 +120,7 @@ PhotonParticleContainer::PushPX (WarpXParIter& pti,
 #ifdef WARPX_QED
     BreitWheelerEvolveOpticalDepth evolve_opt;
     amrex::ParticleReal* AMREX_RESTRICT p_optical_depth_BW = nullptr;
-    const bool local_has_breit_wheeler = has_breit_wheeler();
+    bool local_has_breit_wheeler = has_breit_wheeler();
     if (local_has_breit_wheeler) {
         evolve_opt = m_shr_p_bw_engine->build_evolve_functor();
         p_optical_depth_BW = pti.GetAttribs(particle_comps["opticalDepthBW"]).dataPtr() + offset;
@@ -134,6 +135,18 @@ PhotonParticleContainer::PushPX (WarpXParIter& pti,
 
     const auto getExternalEB = GetExternalEBField(pti, offset);
 
+#ifdef WARPX_QED
+    // The optical depth is not evolved for photons with chi < bw_minimum_chi_phot:
+    // skip the evolution altogether if this holds for all the photons of the tile
+    if (local_has_breit_wheeler && getExternalEB.isNoOp() && np_to_push > 0) {
+        const auto bounds = getTileFieldBounds(pti, box,
+            *exfab, *eyfab, *ezfab, *bxfab, *byfab, *bzfab,
+            m_E_external_particle, m_B_external_particle, offset, np_to_push);
+        local_has_breit_wheeler = QedUtils::chi_photon_upper_bound(
+            bounds.E_max, bounds.B_max, bounds.u_max) >= m_shr_p_bw_engine->get_minimum_chi_phot();
+    }
+#endif
+
     const amrex::ParticleReal Ex_external_particle = m_E_external_particle[0];
     const amrex::ParticleReal Ey_external_particle = m_E_external_particle[1];
     const amrex::ParticleReal Ez_external_particle = m_E_external_particle[2];
@@ -23,6 +23,7 @@
 #endif
 #include "Particles/Gather/FieldGather.H"
 #include "Particles/Gather/GetExternalFields.H"
+#include "Particles/Gather/TileFieldBounds.H"
 #include "Particles/ParticleCreation/DefaultInitialization.H"
 #include "Particles/Pusher/CopyParticleAttribs.H"
 #include "Particles/Pusher/GetAndSetPosition.H"
@@ -305,6 +306,12 @@ PhysicalParticleContainer::PhysicalParticleContainer (AmrCore* amr_core, int isp
     pp_species_name.query("do_not_deposit", do_not_deposit);
     pp_species_name.query("do_not_gather", do_not_gather);
     pp_species_name.query("do_not_push", do_not_push);
+    utils::parser::queryWithParser(pp_species_name, "push_interval", m_push_interval);
+    utils::parser::queryWithParser(pp_species_name, "push_substeps", m_push_substeps);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_push_interval >= 1 && m_push_substeps >= 1,
+        species_name + ".push_interval and " + species_name + ".push_substeps must be at least 1");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_push_interval == 1 || m_push_substeps == 1,
+        species_name + ".push_interval and " + species_name + ".push_substeps cannot be used together");
 
     pp_species_name.query("do_continuous_injection", do_continuous_injection);
     pp_species_name.query("initialize_self_fields", initialize_self_fields);
@@ -1802,13 +1809,70 @@ void
 PhysicalParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
                                    int lev,
                                    const std::string& current_fp_string,
-                                   Real /*t*/, Real dt, DtType a_dt_type, bool skip_deposition,
+                                   Real t, Real dt, DtType a_dt_type, bool skip_deposition,
                                    PushType push_type)
+{
+    if ((m_push_interval > 1 || m_push_substeps > 1) && !m_in_multirate_evolve) {
+        EvolveMultiRate(fields, lev, current_fp_string, t, dt, a_dt_type, skip_deposition, push_type);
+        return;
+    }
+
+    WARPX_PROFILE("PhysicalParticleContainer::Evolve()");
+
+    EvolveBegin(lev, dt);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+    {
+#ifdef AMREX_USE_OMP
+        const int thread_num = omp_get_thread_num();
+#else
+        const int thread_num = 0;
+#endif
+
+        std::array<FArrayBox, 6> filtered_fields;
+
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
+        {
+            EvolveTile(pti, fields, lev, current_fp_string, dt, a_dt_type, skip_deposition,
+                       push_type, thread_num, filtered_fields);
+        }
+    }
+
+    EvolveEnd(lev, a_dt_type);
+}
+
+void
+PhysicalParticleContainer::EvolveBegin (int lev, Real /*dt*/)
+{
+    if (m_do_back_transformed_particles)
+    {
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
+        {
+            const auto np = pti.numParticles();
+            const auto t_lev = pti.GetLevel();
+            const auto index = pti.GetPairIndex();
+            tmp_particle_data.resize(finestLevel()+1);
+            for (int i = 0; i < TmpIdx::nattribs; ++i) {
+                tmp_particle_data[t_lev][index][i].resize(np);
+            }
+        }
+    }
+}
+
+void
+PhysicalParticleContainer::EvolveTile (WarpXParIter& pti,
+                                       ablastr::fields::MultiFabRegister& fields,
+                                       int lev,
+                                       const std::string& current_fp_string,
+                                       Real dt, DtType a_dt_type, bool skip_deposition,
+                                       PushType push_type, int thread_num,
+                                       std::array<amrex::FArrayBox, 6>& filtered_fields)
 {
     using ablastr::fields::Direction;
     using warpx::fields::FieldType;
 
-    WARPX_PROFILE("PhysicalParticleContainer::Evolve()");
     WARPX_PROFILE_VAR_NS("PhysicalParticleContainer::Evolve::GatherAndPush", blp_fg);
 
     BL_ASSERT(OnSameGrids(lev, *fields.get(FieldType::current_fp, Direction{0}, lev)));
@@ -1830,247 +1894,221 @@ PhysicalParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
     amrex::MultiFab & By = *fields.get(FieldType::Bfield_aux, Direction{1}, lev);
     amrex::MultiFab & Bz = *fields.get(FieldType::Bfield_aux, Direction{2}, lev);
 
-    if (m_do_back_transformed_particles)
+    if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
     {
-        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
-        {
-            const auto np = pti.numParticles();
-            const auto t_lev = pti.GetLevel();
-            const auto index = pti.GetPairIndex();
-            tmp_particle_data.resize(finestLevel()+1);
-            for (int i = 0; i < TmpIdx::nattribs; ++i) {
-                tmp_particle_data[t_lev][index][i].resize(np);
-            }
-        }
+        amrex::Gpu::synchronize();
     }
+    auto wt = static_cast<amrex::Real>(amrex::second());
 
-#ifdef AMREX_USE_OMP
-#pragma omp parallel
-#endif
-    {
-#ifdef AMREX_USE_OMP
-        const int thread_num = omp_get_thread_num();
-#else
-        const int thread_num = 0;
-#endif
+    const Box& box = pti.validbox();
 
-        FArrayBox filtered_Ex, filtered_Ey, filtered_Ez;
-        FArrayBox filtered_Bx, filtered_By, filtered_Bz;
-
-        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
-        {
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
-            {
-                amrex::Gpu::synchronize();
-            }
-            auto wt = static_cast<amrex::Real>(amrex::second());
-
-            const Box& box = pti.validbox();
-
-            // Extract particle data
-            auto& attribs = pti.GetAttribs();
-            auto&  wp = attribs[PIdx::w];
-            auto& uxp = attribs[PIdx::ux];
-            auto& uyp = attribs[PIdx::uy];
-            auto& uzp = attribs[PIdx::uz];
+    // Extract particle data
+    auto& attribs = pti.GetAttribs();
+    auto&  wp = attribs[PIdx::w];
+    auto& uxp = attribs[PIdx::ux];
+    auto& uyp = attribs[PIdx::uy];
+    auto& uzp = attribs[PIdx::uz];
 
-            const long np = pti.numParticles();
+    const long np = pti.numParticles();
 
-            // Data on the grid
-            FArrayBox const* exfab = &Ex[pti];
-            FArrayBox const* eyfab = &Ey[pti];
-            FArrayBox const* ezfab = &Ez[pti];
-            FArrayBox const* bxfab = &Bx[pti];
-            FArrayBox const* byfab = &By[pti];
-            FArrayBox const* bzfab = &Bz[pti];
+    // Data on the grid
+    FArrayBox const* exfab = &Ex[pti];
+    FArrayBox const* eyfab = &Ey[pti];
+    FArrayBox const* ezfab = &Ez[pti];
+    FArrayBox const* bxfab = &Bx[pti];
+    FArrayBox const* byfab = &By[pti];
+    FArrayBox const* bzfab = &Bz[pti];
 
-            Elixir exeli, eyeli, ezeli, bxeli, byeli, bzeli;
+    Elixir exeli, eyeli, ezeli, bxeli, byeli, bzeli;
 
-            if (WarpX::use_fdtd_nci_corr)
-            {
-                // Filter arrays Ex[pti], store the result in
-                // filtered_Ex and update pointer exfab so that it
-                // points to filtered_Ex (and do the same for all
-                // components of E and B).
-                applyNCIFilter(lev, pti.tilebox(), exeli, eyeli, ezeli, bxeli, byeli, bzeli,
-                               filtered_Ex, filtered_Ey, filtered_Ez,
-                               filtered_Bx, filtered_By, filtered_Bz,
-                               Ex[pti], Ey[pti], Ez[pti], Bx[pti], By[pti], Bz[pti],
-                               exfab, eyfab, ezfab, bxfab, byfab, bzfab);
-            }
+    if (WarpX::use_fdtd_nci_corr)
+    {
+        // Filter arrays Ex[pti], store the result in
+        // filtered_Ex and update pointer exfab so that it
+        // points to filtered_Ex (and do the same for all
+        // components of E and B).
+        applyNCIFilter(lev, pti.tilebox(), exeli, eyeli, ezeli, bxeli, byeli, bzeli,
+                       filtered_fields[0], filtered_fields[1], filtered_fields[2],
+                       filtered_fields[3], filtered_fields[4], filtered_fields[5],
+                       Ex[pti], Ey[pti], Ez[pti], Bx[pti], By[pti], Bz[pti],
+                       exfab, eyfab, ezfab, bxfab, byfab, bzfab);
+    }
 
-            // Determine which particles deposit/gather in the buffer, and
-            // which particles deposit/gather in the fine patch
-            long nfine_current = np;
-            long nfine_gather = np;
-            if (has_buffer && !do_not_push) {
-                // - Modify `nfine_current` and `nfine_gather` (in place)
-                //    so that they correspond to the number of particles
-                //    that deposit/gather in the fine patch respectively.
-                // - Reorder the particle arrays,
-                //    so that the `nfine_current`/`nfine_gather` first particles
-                //    deposit/gather in the fine patch
-                //    and (thus) the `np-nfine_current`/`np-nfine_gather` last particles
-                //    deposit/gather in the buffer
-                PartitionParticlesInBuffers( nfine_current, nfine_gather, np,
-                    pti, lev, current_masks, gather_masks );
-            }
+    // Determine which particles deposit/gather in the buffer, and
+    // which particles deposit/gather in the fine patch
+    long nfine_current = np;
+    long nfine_gather = np;
+    if (has_buffer && !do_not_push) {
+        // - Modify `nfine_current` and `nfine_gather` (in place)
+        //    so that they correspond to the number of particles
+        //    that deposit/gather in the fine patch respectively.
+        // - Reorder the particle arrays,
+        //    so that the `nfine_current`/`nfine_gather` first particles
+        //    deposit/gather in the fine patch
+        //    and (thus) the `np-nfine_current`/`np-nfine_gather` last particles
+        //    deposit/gather in the buffer
+        PartitionParticlesInBuffers( nfine_current, nfine_gather, np,
+            pti, lev, current_masks, gather_masks );
+    }
 
-            const long np_current = has_J_buf ? nfine_current : np;
+    const long np_current = has_J_buf ? nfine_current : np;
 
-            if (has_rho && ! skip_deposition && ! do_not_deposit) {
-                // Deposit charge before particle push, in component 0 of MultiFab rho.
+    if (has_rho && ! skip_deposition && ! do_not_deposit) {
+        // Deposit charge before particle push, in component 0 of MultiFab rho.
 
-                const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
-                    pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+        const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
+            pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
 
-                amrex::MultiFab* rho = fields.get(FieldType::rho_fp, lev);
-                DepositCharge(pti, wp, ion_lev, rho, 0, 0,
-                              np_current, thread_num, lev, lev);
-                if (has_buffer){
-                    amrex::MultiFab* crho = fields.get(FieldType::rho_buf, lev);
-                    DepositCharge(pti, wp, ion_lev, crho, 0, np_current,
-                                  np-np_current, thread_num, lev, lev-1);
-                }
-            }
+        amrex::MultiFab* rho = fields.get(FieldType::rho_fp, lev);
+        DepositCharge(pti, wp, ion_lev, rho, 0, 0,
+                      np_current, thread_num, lev, lev);
+        if (has_buffer){
+            amrex::MultiFab* crho = fields.get(FieldType::rho_buf, lev);
+            DepositCharge(pti, wp, ion_lev, crho, 0, np_current,
+                          np-np_current, thread_num, lev, lev-1);
+        }
+    }
 
-            if (! do_not_push)
-            {
-                const long np_gather = has_E_cax ? nfine_gather : np;
-
-                int e_is_nodal = Ex.is_nodal() and Ey.is_nodal() and Ez.is_nodal();
-
-                //
-                // Gather and push for particles not in the buffer
-                //
-                WARPX_PROFILE_VAR_START(blp_fg);
-                const auto np_to_push = np_gather;
-                const auto gather_lev = lev;
-                if (push_type == PushType::Explicit) {
-                    PushPX(pti, exfab, eyfab, ezfab,
+    if (! do_not_push)
+    {
+        const long np_gather = has_E_cax ? nfine_gather : np;
+
+        int e_is_nodal = Ex.is_nodal() and Ey.is_nodal() and Ez.is_nodal();
+
+        //
+        // Gather and push for particles not in the buffer
+        //
+        WARPX_PROFILE_VAR_START(blp_fg);
+        const auto np_to_push = np_gather;
+        const auto gather_lev = lev;
+        if (push_type == PushType::Explicit) {
+            PushPX(pti, exfab, eyfab, ezfab,
+                   bxfab, byfab, bzfab,
+                   Ex.nGrowVect(), e_is_nodal,
+                   0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type);
+        } else if (push_type == PushType::Implicit) {
+            ImplicitPushXP(pti, exfab, eyfab, ezfab,
                            bxfab, byfab, bzfab,
                            Ex.nGrowVect(), e_is_nodal,
                            0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type);
-                } else if (push_type == PushType::Implicit) {
-                    ImplicitPushXP(pti, exfab, eyfab, ezfab,
-                                   bxfab, byfab, bzfab,
-                                   Ex.nGrowVect(), e_is_nodal,
-                                   0, np_to_push, lev, gather_lev, dt, ScaleFields(false), a_dt_type);
-                }
+        }
 
-                if (np_gather < np)
-                {
-                    const IntVect& ref_ratio = WarpX::RefRatio(lev-1);
-                    const Box& cbox = amrex::coarsen(box,ref_ratio);
-
-                    amrex::MultiFab & cEx = *fields.get(FieldType::Efield_cax, Direction{0}, lev);
-                    amrex::MultiFab & cEy = *fields.get(FieldType::Efield_cax, Direction{1}, lev);
-                    amrex::MultiFab & cEz = *fields.get(FieldType::Efield_cax, Direction{2}, lev);
-                    amrex::MultiFab & cBx = *fields.get(FieldType::Bfield_cax, Direction{0}, lev);
-                    amrex::MultiFab & cBy = *fields.get(FieldType::Bfield_cax, Direction{1}, lev);
-                    amrex::MultiFab & cBz = *fields.get(FieldType::Bfield_cax, Direction{2}, lev);
-
-                    // Data on the grid
-                    FArrayBox const* cexfab = &cEx[pti];
-                    FArrayBox const* ceyfab = &cEy[pti];
-                    FArrayBox const* cezfab = &cEz[pti];
-                    FArrayBox const* cbxfab = &cBx[pti];
-                    FArrayBox const* cbyfab = &cBy[pti];
-                    FArrayBox const* cbzfab = &cBz[pti];
-
-                    if (WarpX::use_fdtd_nci_corr)
-                    {
-                        // Filter arrays (*cEx)[pti], store the result in
-                        // filtered_Ex and update pointer cexfab so that it
-                        // points to filtered_Ex (and do the same for all
-                        // components of E and B)
-                        applyNCIFilter(lev-1, cbox, exeli, eyeli, ezeli, bxeli, byeli, bzeli,
-                                       filtered_Ex, filtered_Ey, filtered_Ez,
-                                       filtered_Bx, filtered_By, filtered_Bz,
-                                       cEx[pti], cEy[pti], cEz[pti],
-                                       cBx[pti], cBy[pti], cBz[pti],
-                                       cexfab, ceyfab, cezfab, cbxfab, cbyfab, cbzfab);
-                    }
+        if (np_gather < np)
+        {
+            const IntVect& ref_ratio = WarpX::RefRatio(lev-1);
+            const Box& cbox = amrex::coarsen(box,ref_ratio);
+
+            amrex::MultiFab & cEx = *fields.get(FieldType::Efield_cax, Direction{0}, lev);
+            amrex::MultiFab & cEy = *fields.get(FieldType::Efield_cax, Direction{1}, lev);
+            amrex::MultiFab & cEz = *fields.get(FieldType::Efield_cax, Direction{2}, lev);
+            amrex::MultiFab & cBx = *fields.get(FieldType::Bfield_cax, Direction{0}, lev);
+            amrex::MultiFab & cBy = *fields.get(FieldType::Bfield_cax, Direction{1}, lev);
+            amrex::MultiFab & cBz = *fields.get(FieldType::Bfield_cax, Direction{2}, lev);
+
+            // Data on the grid
+            FArrayBox const* cexfab = &cEx[pti];
+            FArrayBox const* ceyfab = &cEy[pti];
+            FArrayBox const* cezfab = &cEz[pti];
+            FArrayBox const* cbxfab = &cBx[pti];
+            FArrayBox const* cbyfab = &cBy[pti];
+            FArrayBox const* cbzfab = &cBz[pti];
 
-                    // Field gather and push for particles in gather buffers
-                    e_is_nodal = cEx.is_nodal() and cEy.is_nodal() and cEz.is_nodal();
-                    if (push_type == PushType::Explicit) {
-                        PushPX(pti, cexfab, ceyfab, cezfab,
+            if (WarpX::use_fdtd_nci_corr)
+            {
+                // Filter arrays (*cEx)[pti], store the result in
+                // filtered_Ex and update pointer cexfab so that it
+                // points to filtered_Ex (and do the same for all
+                // components of E and B)
+                applyNCIFilter(lev-1, cbox, exeli, eyeli, ezeli, bxeli, byeli, bzeli,
+                               filtered_fields[0], filtered_fields[1], filtered_fields[2],
+                               filtered_fields[3], filtered_fields[4], filtered_fields[5],
+                               cEx[pti], cEy[pti], cEz[pti],
+                               cBx[pti], cBy[pti], cBz[pti],
+                               cexfab, ceyfab, cezfab, cbxfab, cbyfab, cbzfab);
+            }
+
+            // Field gather and push for particles in gather buffers
+            e_is_nodal = cEx.is_nodal() and cEy.is_nodal() and cEz.is_nodal();
+            if (push_type == PushType::Explicit) {
+                PushPX(pti, cexfab, ceyfab, cezfab,
+                       cbxfab, cbyfab, cbzfab,
+                       cEx.nGrowVect(), e_is_nodal,
+                       nfine_gather, np-nfine_gather,
+                       lev, lev-1, dt, ScaleFields(false), a_dt_type);
+            } else if (push_type == PushType::Implicit) {
+                ImplicitPushXP(pti, cexfab, ceyfab, cezfab,
                                cbxfab, cbyfab, cbzfab,
                                cEx.nGrowVect(), e_is_nodal,
                                nfine_gather, np-nfine_gather,
                                lev, lev-1, dt, ScaleFields(false), a_dt_type);
-                    } else if (push_type == PushType::Implicit) {
-                        ImplicitPushXP(pti, cexfab, ceyfab, cezfab,
-                                       cbxfab, cbyfab, cbzfab,
-                                       cEx.nGrowVect(), e_is_nodal,
-                                       nfine_gather, np-nfine_gather,
-                                       lev, lev-1, dt, ScaleFields(false), a_dt_type);
-                    }
-                }
+            }
+        }
 
-                WARPX_PROFILE_VAR_STOP(blp_fg);
+        WARPX_PROFILE_VAR_STOP(blp_fg);
 
-                // Current Deposition
-                if (!skip_deposition)
-                {
-                    // Deposit at t_{n+1/2} with explicit push
-                    const amrex::Real relative_time = (push_type == PushType::Explicit ? -0.5_rt * dt : 0.0_rt);
-
-                    const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
-                        pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
-
-                    // Deposit inside domains
-                    amrex::MultiFab * jx = fields.get(current_fp_string, Direction{0}, lev);
-                    amrex::MultiFab * jy = fields.get(current_fp_string, Direction{1}, lev);
-                    amrex::MultiFab * jz = fields.get(current_fp_string, Direction{2}, lev);
-                    DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, jx, jy, jz,
-                                   0, np_current, thread_num,
-                                   lev, lev, dt, relative_time, push_type);
-
-                    if (has_buffer)
-                    {
-                        // Deposit in buffers
-                        amrex::MultiFab * cjx = fields.get(FieldType::current_buf, Direction{0}, lev);
-                        amrex::MultiFab * cjy = fields.get(FieldType::current_buf, Direction{1}, lev);
-                        amrex::MultiFab * cjz = fields.get(FieldType::current_buf, Direction{2}, lev);
-                        DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, cjx, cjy, cjz,
-                                       np_current, np-np_current, thread_num,
-                                       lev, lev-1, dt, relative_time, push_type);
-                    }
-                } // end of "if electrostatic_solver_id == ElectrostaticSolverAlgo::None"
-            } // end of "if do_not_push"
-
-            if (has_rho && ! skip_deposition && ! do_not_deposit) {
-                // Deposit charge after particle push, in component 1 of MultiFab rho.
-                // (Skipped for electrostatic solver, as this may lead to out-of-bounds)
-                if (WarpX::electrostatic_solver_id == ElectrostaticSolverAlgo::None) {
-                    amrex::MultiFab* rho = fields.get(FieldType::rho_fp, lev);
-                    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(rho->nComp() >= 2,
-                        "Cannot deposit charge in rho component 1: only component 0 is allocated!");
-
-                    const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
-                        pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
-
-                    DepositCharge(pti, wp, ion_lev, rho, 1, 0,
-                                  np_current, thread_num, lev, lev);
-                    if (has_buffer){
-                        amrex::MultiFab* crho = fields.get(FieldType::rho_buf, lev);
-                        DepositCharge(pti, wp, ion_lev, crho, 1, np_current,
-                                      np-np_current, thread_num, lev, lev-1);
-                    }
-                }
-            }
+        // Current Deposition
+        if (!skip_deposition)
+        {
+            // Deposit at t_{n+1/2} with explicit push
+            const amrex::Real relative_time = (push_type == PushType::Explicit ? -0.5_rt * dt : 0.0_rt);
 
-            amrex::Gpu::synchronize();
+            const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
+                pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+
+            // Deposit inside domains
+            amrex::MultiFab * jx = fields.get(current_fp_string, Direction{0}, lev);
+            amrex::MultiFab * jy = fields.get(current_fp_string, Direction{1}, lev);
+            amrex::MultiFab * jz = fields.get(current_fp_string, Direction{2}, lev);
+            DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, jx, jy, jz,
+                           0, np_current, thread_num,
+                           lev, lev, dt, relative_time, push_type);
 
-            if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+            if (has_buffer)
             {
-                wt = static_cast<amrex::Real>(amrex::second()) - wt;
-                amrex::HostDevice::Atomic::Add( &(*cost)[pti.index()], wt);
+                // Deposit in buffers
+                amrex::MultiFab * cjx = fields.get(FieldType::current_buf, Direction{0}, lev);
+                amrex::MultiFab * cjy = fields.get(FieldType::current_buf, Direction{1}, lev);
+                amrex::MultiFab * cjz = fields.get(FieldType::current_buf, Direction{2}, lev);
+                DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, cjx, cjy, cjz,
+                               np_current, np-np_current, thread_num,
+                               lev, lev-1, dt, relative_time, push_type);
+            }
+        } // end of "if electrostatic_solver_id == ElectrostaticSolverAlgo::None"
+    } // end of "if do_not_push"
+
+    if (has_rho && ! skip_deposition && ! do_not_deposit) {
+        // Deposit charge after particle push, in component 1 of MultiFab rho.
+        // (Skipped for electrostatic solver, as this may lead to out-of-bounds)
+        if (WarpX::electrostatic_solver_id == ElectrostaticSolverAlgo::None) {
+            amrex::MultiFab* rho = fields.get(FieldType::rho_fp, lev);
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(rho->nComp() >= 2,
+                "Cannot deposit charge in rho component 1: only component 0 is allocated!");
+
+            const int* const AMREX_RESTRICT ion_lev = (do_field_ionization)?
+                pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr():nullptr;
+
+            DepositCharge(pti, wp, ion_lev, rho, 1, 0,
+                          np_current, thread_num, lev, lev);
+            if (has_buffer){
+                amrex::MultiFab* crho = fields.get(FieldType::rho_buf, lev);
+                DepositCharge(pti, wp, ion_lev, crho, 1, np_current,
+                              np-np_current, thread_num, lev, lev-1);
             }
         }
     }
+
+    amrex::Gpu::synchronize();
+
+    if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+    {
+        wt = static_cast<amrex::Real>(amrex::second()) - wt;
+        amrex::HostDevice::Atomic::Add( &(*cost)[pti.index()], wt);
+    }
+}
+
+void
+PhysicalParticleContainer::EvolveEnd (int lev, DtType a_dt_type)
+{
     // Split particles at the end of the timestep.
     // When subcycling is ON, the splitting is done on the last call to
     // PhysicalParticleContainer::Evolve on the finest level, i.e., at the
@@ -2083,6 +2121,77 @@ PhysicalParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
     }
 }
 
+void
+PhysicalParticleContainer::EvolveMultiRate (ablastr::fields::MultiFabRegister& fields,
+                                            int lev,
+                                            const std::string& current_fp_string,
+                                            Real t, Real dt, DtType a_dt_type, bool skip_deposition,
+                                            PushType push_type)
+{
+    using ablastr::fields::Direction;
+    using warpx::fields::FieldType;
+
+    WARPX_PROFILE("PhysicalParticleContainer::EvolveMultiRate()");
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        lev == 0 && a_dt_type == DtType::Full && push_type == PushType::Explicit,
+        "push_interval and push_substeps (species '" + species_name + "') are only "
+        "supported with the explicit schemes, without mesh refinement");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(skip_deposition || !fields.has(FieldType::rho_fp, lev),
+        "push_interval and push_substeps (species '" + species_name + "') are not "
+        "supported when the charge density is deposited with the current (e.g. PSATD)");
+
+    const int step = WarpX::GetInstance().getistep(lev);
+    const bool push_this_step = (step % m_push_interval == 0);
+    const Real dt_push = (m_push_substeps > 1) ? dt/m_push_substeps : dt*m_push_interval;
+
+    m_in_multirate_evolve = true;
+
+    if (skip_deposition) {
+        // Electrostatic and hybrid solvers: only push the particles
+        if (push_this_step) {
+            for (int isub = 0; isub < m_push_substeps; ++isub) {
+                Evolve(fields, lev, current_fp_string, t + isub*dt_push, dt_push,
+                       a_dt_type, skip_deposition, push_type);
+            }
+        }
+        m_in_multirate_evolve = false;
+        return;
+    }
+
+    // The current of this species is deposited in its own buffer,
+    // defined on the same grids as the total current
+    const std::string current_species_string = MultiRateCurrentName(species_name);
+    if (!fields.has_vector(current_species_string, lev)) {
+        for (int idir = 0; idir < 3; ++idir) {
+            const amrex::MultiFab& J = *fields.get(current_fp_string, Direction{idir}, lev);
+            fields.alloc_init(current_species_string, Direction{idir}, lev,
+                              J.boxArray(), J.DistributionMap(), J.nComp(), J.nGrowVect(), 0.0_rt);
+        }
+    }
+
+    if (push_this_step) {
+        for (int idir = 0; idir < 3; ++idir) {
+            fields.get(current_species_string, Direction{idir}, lev)->setVal(0.0_rt);
+        }
+        for (int isub = 0; isub < m_push_substeps; ++isub) {
+            Evolve(fields, lev, current_species_string, t + isub*dt_push, dt_push,
+                   a_dt_type, skip_deposition, push_type);
+        }
+    }
+
+    // Super-cycling: the current averaged over push_interval steps is added at every step.
+    // Sub-cycling: the average of the currents of the substeps is added.
+    const Real scale = 1.0_rt/m_push_substeps;
+    for (int idir = 0; idir < 3; ++idir) {
+        amrex::MultiFab& J = *fields.get(current_fp_string, Direction{idir}, lev);
+        const amrex::MultiFab& J_species = *fields.get(current_species_string, Direction{idir}, lev);
+        amrex::MultiFab::Saxpy(J, scale, J_species, 0, 0, J.nComp(), J.nGrowVect());
+    }
+
+    m_in_multirate_evolve = false;
+}
+
 void
 PhysicalParticleContainer::applyNCIFilter (
     int lev, const Box& box,
@@ -2363,6 +2472,10 @@ PhysicalParticleContainer::PushP (int lev, Real dt,
 
     if (do_not_push) { return; }
 
+    // Super-cycled (push_interval) and sub-cycled (push_substeps) species are
+    // staggered by a fraction of their own time step, rather than of dt
+    const Real dt_push = (m_push_substeps > 1) ? dt/m_push_substeps : dt*m_push_interval;
+
     const amrex::XDim3 dinv = WarpX::InvCellSize(std::max(lev,0));
 
 #ifdef AMREX_USE_OMP
@@ -2474,25 +2587,25 @@ PhysicalParticleContainer::PushP (int lev, Real dt,
                     if (ion_lev) { qp *= ion_lev[ip]; }
                     UpdateMomentumBorisWithRadiationReaction(ux[ip], uy[ip], uz[ip],
                                                              Exp, Eyp, Ezp, Bxp,
-                                                             Byp, Bzp, qp, m, dt);
+                                                             Byp, Bzp, qp, m, dt_push);
                 } else if (pusher_algo == ParticlePusherAlgo::Boris) {
                     amrex::ParticleReal qp = q;
                     if (ion_lev) { qp *= ion_lev[ip]; }
                     UpdateMomentumBoris( ux[ip], uy[ip], uz[ip],
                                          Exp, Eyp, Ezp, Bxp,
-                                         Byp, Bzp, qp, m, dt);
+                                         Byp, Bzp, qp, m, dt_push);
                 } else if (pusher_algo == ParticlePusherAlgo::Vay) {
                     amrex::ParticleReal qp = q;
                     if (ion_lev){ qp *= ion_lev[ip]; }
                     UpdateMomentumVay( ux[ip], uy[ip], uz[ip],
                                        Exp, Eyp, Ezp, Bxp,
-                                       Byp, Bzp, qp, m, dt);
+                                       Byp, Bzp, qp, m, dt_push);
                 } else if (pusher_algo == ParticlePusherAlgo::HigueraCary) {
                     amrex::ParticleReal qp = q;
                     if (ion_lev){ qp *= ion_lev[ip]; }
                     UpdateMomentumHigueraCary( ux[ip], uy[ip], uz[ip],
                                                Exp, Eyp, Ezp, Bxp,
-                                               Byp, Bzp, qp, m, dt);
+                                               Byp, Bzp, qp, m, dt_push);
                 } else {
                     amrex::Abort("Unknown particle pusher");
                 }
@@ -2607,6 +2720,35 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
     amrex::IndexType const by_type = byfab->box().ixType();
     amrex::IndexType const bz_type = bzfab->box().ixType();
 
+    // Optionally, copy the fields of the gather box into a tile-local buffer
+    // where the six components of each grid point are contiguous
+    const bool gather_interleaved = WarpX::field_gathering_interleaved && !do_not_gather;
+    InterleavedFieldArray ex_iarr, ey_iarr, ez_iarr, bx_iarr, by_iarr, bz_iarr;
+    if (gather_interleaved) {
+        const InterleavedFieldBuffer* buffer = nullptr;
+        if (m_interleaved_field_cache) {
+            // The buffer of this tile is filled by the first species that gathers from it
+            buffer = &m_interleaved_field_cache->GetOrPack(lev, gather_lev, pti.index(), pti.LocalTileIndex(), box,
+                                                           *exfab, *eyfab, *ezfab, *bxfab, *byfab, *bzfab);
+        } else {
+#ifdef AMREX_USE_OMP
+            const int thread_num = omp_get_thread_num();
+#else
+            const int thread_num = 0;
+#endif
+            auto& local_buffer = local_interleaved_fields[thread_num];
+            local_buffer.pack(box, *exfab, *eyfab, *ezfab, *bxfab, *byfab, *bzfab);
+            buffer = &local_buffer;
+        }
+        const auto& interleaved_fields = *buffer;
+        ex_iarr = interleaved_fields.array(0);
+        ey_iarr = interleaved_fields.array(1);
+        ez_iarr = interleaved_fields.array(2);
+        bx_iarr = interleaved_fields.array(3);
+        by_iarr = interleaved_fields.array(4);
+        bz_iarr = interleaved_fields.array(5);
+    }
+
     auto& attribs = pti.GetAttribs();
     ParticleReal* const AMREX_RESTRICT ux = attribs[PIdx::ux].dataPtr() + offset;
     ParticleReal* const AMREX_RESTRICT uy = attribs[PIdx::uy].dataPtr() + offset;
@@ -2651,10 +2793,23 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
 
     QuantumSynchrotronEvolveOpticalDepth evolve_opt;
     amrex::ParticleReal* AMREX_RESTRICT p_optical_depth_QSR = nullptr;
-    const bool local_has_quantum_sync = has_quantum_sync();
+    bool local_has_quantum_sync = has_quantum_sync();
     if (local_has_quantum_sync) {
         evolve_opt = m_shr_p_qs_engine->build_evolve_functor();
         p_optical_depth_QSR = pti.GetAttribs(particle_comps["opticalDepthQSR"]).dataPtr()  + offset;
+
+        // The optical depth is not evolved for particles with chi < qs_minimum_chi_part:
+        // skip the evolution altogether if this holds for all the particles of the tile
+        if (getExternalEB.isNoOp()) {
+            const auto bounds = getTileFieldBounds(pti, box,
+                *exfab, *eyfab, *ezfab, *bxfab, *byfab, *bzfab,
+                m_E_external_particle, m_B_external_particle, offset, np_to_push);
+            // The optical depth is evolved with the momentum after the push
+            const amrex::Real u_max = bounds.u_max + std::abs(this->charge)/this->mass*
+                (bounds.E_max + PhysConst::c*bounds.B_max)*dt;
+            local_has_quantum_sync = QedUtils::chi_ele_pos_upper_bound(
+                bounds.E_max, bounds.B_max, u_max) >= m_shr_p_qs_engine->get_minimum_chi_part();
+        }
     }
 #endif
 
@@ -2662,6 +2817,7 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
 
     enum exteb_flags : int { no_exteb, has_exteb };
     enum qed_flags : int { no_qed, has_qed };
+    enum interleaved_flags : int { no_interleaved, has_interleaved };
 
     const int exteb_runtime_flag = getExternalEB.isNoOp() ? no_exteb : has_exteb;
 #ifdef WARPX_QED
@@ -2669,15 +2825,17 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
 #else
     int qed_runtime_flag = no_qed;
 #endif
+    const int interleaved_runtime_flag = gather_interleaved ? has_interleaved : no_interleaved;
 
     // Using this version of ParallelFor with compile time options
     // improves performance when qed or external EB are not used by reducing
     // register pressure.
     amrex::ParallelFor(
-        TypeList<CompileTimeOptions<no_exteb,has_exteb>, CompileTimeOptions<no_qed  ,has_qed>>{},
-        {exteb_runtime_flag, qed_runtime_flag},
+        TypeList<CompileTimeOptions<no_exteb,has_exteb>, CompileTimeOptions<no_qed  ,has_qed>,
+                 CompileTimeOptions<no_interleaved,has_interleaved>>{},
+        {exteb_runtime_flag, qed_runtime_flag, interleaved_runtime_flag},
         np_to_push,
-        [=] AMREX_GPU_DEVICE (long ip, auto exteb_control, auto qed_control)
+        [=] AMREX_GPU_DEVICE (long ip, auto exteb_control, auto qed_control, auto interleaved_control)
     {
         amrex::ParticleReal xp, yp, zp;
         getPosition(ip, xp, yp, zp);
@@ -2699,7 +2857,14 @@ PhysicalParticleContainer::PushPX (WarpXParIter& pti,
         amrex::ParticleReal Byp = By_external_particle;
         amrex::ParticleReal Bzp = Bz_external_particle;
 
-        if(!t_do_not_gather){
+        if constexpr (interleaved_control == has_interleaved) {
+            // first gather E and B to the particle positions, from the tile-local buffer
+            doGatherShapeN(xp, yp, zp, Exp, Eyp, Ezp, Bxp, Byp, Bzp,
+                           ex_iarr, ey_iarr, ez_iarr, bx_iarr, by_iarr, bz_iarr,
+                           ex_type, ey_type, ez_type, bx_type, by_type, bz_type,
+                           dinv, xyzmin, lo, n_rz_azimuthal_modes,
+                           nox, galerkin_interpolation);
+        } else if(!t_do_not_gather){
             // first gather E and B to the particle positions
             doGatherShapeN(xp, yp, zp, Exp, Eyp, Ezp, Bxp, Byp, Bzp,
                            ex_arr, ey_arr, ez_arr, bx_arr, by_arr, bz_arr,
@@ -3171,6 +3336,83 @@ PhysicalParticleContainer::InitIonizationModule ()
     });
 
     Gpu::synchronize();
+
+    utils::parser::queryWithParser(pp_species_name, "do_adk_rate_table", do_adk_rate_table);
+    if (!do_adk_rate_table) { return; }
+    utils::parser::queryWithParser(
+        pp_species_name, "adk_rate_table_npoints", adk_rate_table_npoints);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(adk_rate_table_npoints >= 2,
+        species_name + ".adk_rate_table_npoints must be at least 2");
+
+    // Tabulate log(rate) in log(|E|) for all the levels. The table is built on the host,
+    // in double precision, from the coefficients computed above.
+    Vector<Real> h_adk_power(ion_atomic_number);
+    Vector<Real> h_adk_prefactor(ion_atomic_number);
+    Vector<Real> h_adk_exp_prefactor(ion_atomic_number);
+    Vector<Real> h_correction_factors(4);
+    Gpu::copyAsync(Gpu::deviceToHost, adk_power.begin(), adk_power.end(), h_adk_power.begin());
+    Gpu::copyAsync(Gpu::deviceToHost, adk_prefactor.begin(), adk_prefactor.end(), h_adk_prefactor.begin());
+    Gpu::copyAsync(Gpu::deviceToHost, adk_exp_prefactor.begin(), adk_exp_prefactor.end(),
+        h_adk_exp_prefactor.begin());
+    Gpu::copyAsync(Gpu::deviceToHost, adk_correction_factors.begin(), adk_correction_factors.end(),
+        h_correction_factors.begin());
+    Gpu::streamSynchronize();
+
+    const auto log_rate = [&](int i, double log_E){
+        const double E = std::exp(log_E);
+        double res = std::log(static_cast<double>(h_adk_prefactor[i])) +
+            h_adk_power[i]*log_E + h_adk_exp_prefactor[i]/E;
+        if (do_adk_correction) {
+            const double r = E / h_correction_factors[3];
+            res += h_correction_factors[0]*r*r + h_correction_factors[1]*r + h_correction_factors[2];
+        }
+        return res;
+    };
+
+    // The rate of each level increases with |E| up to E_peak = exp_prefactor/power.
+    // Below the threshold field, the rates of all the levels are below a floor of
+    // epsilon (in 1/s): the ionization probability per step, rate*dt, is then below
+    // the resolution of the random numbers for any time step shorter than 1 s.
+    // The floor does not depend on dt, so that the table remains valid when dt changes.
+    const double log_negligible_rate = std::log(
+        static_cast<double>(std::numeric_limits<Real>::epsilon()));
+    double log_threshold = std::numeric_limits<double>::max();
+    double log_emax = std::numeric_limits<double>::lowest();
+    for (int i=0; i<ion_atomic_number; i++){
+        const double epeak = static_cast<double>(h_adk_exp_prefactor[i])/h_adk_power[i];
+        const double log_epeak = std::log(
+            (epeak > 0.) ? epeak : static_cast<double>(std::numeric_limits<Real>::max()));
+        log_emax = std::max(log_emax, log_epeak);
+        if (log_rate(i, log_epeak) < log_negligible_rate) { continue; }
+        double lo = log_epeak - 100.;
+        double hi = log_epeak;
+        for (int it=0; it<100; it++){
+            const double mid = 0.5*(lo + hi);
+            if (log_rate(i, mid) < log_negligible_rate) { lo = mid; } else { hi = mid; }
+        }
+        log_threshold = std::min(log_threshold, lo);
+    }
+    if (log_threshold > log_emax) { log_threshold = log_emax - 1.; }
+
+    const int npts = adk_rate_table_npoints;
+    const double dlog = (log_emax - log_threshold)/(npts - 1);
+    Vector<Real> h_adk_rate_table(ion_atomic_number*npts);
+    for (int i=0; i<ion_atomic_number; i++){
+        for (int k=0; k<npts; k++){
+            h_adk_rate_table[i*npts + k] = static_cast<Real>(log_rate(i, log_threshold + k*dlog));
+        }
+    }
+
+    adk_rate_table.resize(h_adk_rate_table.size());
+    Gpu::copyAsync(Gpu::hostToDevice,
+                   h_adk_rate_table.begin(), h_adk_rate_table.end(),
+                   adk_rate_table.begin());
+    adk_rate_table_log_emin = static_cast<Real>(log_threshold);
+    adk_rate_table_inv_dlog = static_cast<Real>(1./dlog);
+    adk_rate_table_emax = static_cast<Real>(std::exp(log_emax));
+    adk_threshold_field = static_cast<Real>(std::exp(log_threshold));
+
+    Gpu::synchronize();
 }
 
 IonizationFilterFunc
@@ -3195,7 +3437,50 @@ PhysicalParticleContainer::getIonizationFunc (const WarpXParIter& pti,
                                 adk_correction_factors.dataPtr(),
                                 particle_icomps["ionizationLevel"],
                                 ion_atomic_number,
-                                do_adk_correction};
+                                do_adk_correction,
+                                ADKRateTableView{
+                                    do_adk_rate_table ? adk_rate_table.dataPtr() : nullptr,
+                                    adk_rate_table_npoints,
+                                    adk_rate_table_log_emin,
+                                    adk_rate_table_inv_dlog,
+                                    adk_rate_table_emax,
+                                    adk_threshold_field}};
+}
+
+bool
+PhysicalParticleContainer::isTileBelowIonizationThreshold (const WarpXParIter& pti,
+                                                           int /*lev*/,
+                                                           amrex::IntVect ngEB,
+                                                           const amrex::FArrayBox& Ex,
+                                                           const amrex::FArrayBox& Ey,
+                                                           const amrex::FArrayBox& Ez,
+                                                           const amrex::FArrayBox& Bx,
+                                                           const amrex::FArrayBox& By,
+                                                           const amrex::FArrayBox& Bz)
+{
+    WARPX_PROFILE("PhysicalParticleContainer::isTileBelowIonizationThreshold()");
+
+    // Without tabulated rates there is no threshold field
+    if (!do_adk_rate_table) { return false; }
+
+    // External fields evaluated at the particle positions cannot be bounded a priori
+    const auto get_externalEB = GetExternalEBField(pti);
+    if (!get_externalEB.isNoOp()) { return false; }
+
+    const long np = pti.numParticles();
+    if (np == 0) { return true; }
+
+    amrex::Box box = pti.tilebox();
+    box.grow(ngEB);
+    const auto bounds = getTileFieldBounds(pti, box, Ex, Ey, Ez, Bx, By, Bz,
+        m_E_external_particle, m_B_external_particle, 0, np);
+
+    // In the particle frame, |E'| <= gamma*|E| + |u|*|B|
+    constexpr amrex::Real c2_inv = 1._rt/(PhysConst::c*PhysConst::c);
+    const amrex::Real u_max = bounds.u_max;
+    const amrex::Real gamma_max = std::sqrt(1._rt + u_max*u_max*c2_inv);
+
+    return (gamma_max*bounds.E_max + u_max*bounds.B_max) <= adk_threshold_field;
 }
 
 PlasmaInjector* PhysicalParticleContainer::GetPlasmaInjector (int i)
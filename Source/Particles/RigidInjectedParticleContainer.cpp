@@ -247,11 +247,7 @@ RigidInjectedParticleContainer::PushPX (WarpXParIter& pti,
 }
 
 void
-RigidInjectedParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
-                                        int lev,
-                                        const std::string& current_fp_string,
-                                        Real t, Real dt, DtType a_dt_type, bool skip_deposition,
-                                        PushType push_type)
+RigidInjectedParticleContainer::EvolveBegin (int lev, Real dt)
 {
 
     // Update location of injection plane in the boosted frame
@@ -268,10 +264,7 @@ RigidInjectedParticleContainer::Evolve (ablastr::fields::MultiFabRegister& field
     done_injecting_lev = ((zinject_plane_levels[lev] < plo[WARPX_ZINDEX] && WarpX::moving_window_v + WarpX::beta_boost*PhysConst::c >= 0.) ||
                            (zinject_plane_levels[lev] > phi[WARPX_ZINDEX] && WarpX::moving_window_v + WarpX::beta_boost*PhysConst::c <= 0.));
 
-    PhysicalParticleContainer::Evolve (fields,
-                                       lev,
-                                       current_fp_string,
-                                       t, dt, a_dt_type, skip_deposition, push_type);
+    PhysicalParticleContainer::EvolveBegin(lev, dt);
 }
 
 void
@@ -0,0 +1,52 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "TileMajorIter.H"
+
+#include <AMReX_MFIter.H>
+
+#include <algorithm>
+#include <limits>
+
+TileMajorIter::TileMajorIter (const amrex::Vector<WarpXParticleContainer*>& containers, int lev)
+{
+    for (auto* pc : containers) {
+        // Static scheduling: the iterators of all the species of a thread cover the same tiles
+        amrex::MFItInfo info;
+        m_iters.push_back(std::make_unique<WarpXParIter>(*pc, lev, info, false));
+    }
+    m_is_active.resize(m_iters.size(), 0);
+    FindCurrentTile();
+}
+
+void
+TileMajorIter::operator++ ()
+{
+    for (int i = 0; i < numSpecies(); ++i) {
+        if (m_is_active[i]) { ++(*m_iters[i]); }
+    }
+    FindCurrentTile();
+}
+
+void
+TileMajorIter::FindCurrentTile ()
+{
+    int next_index = std::numeric_limits<int>::max();
+    for (const auto& it : m_iters) {
+        if (it->isValid()) { next_index = std::min(next_index, it->LocalIndex()); }
+    }
+
+    m_current_index = -1;
+    for (int i = 0; i < numSpecies(); ++i) {
+        const auto& it = m_iters[i];
+        m_is_active[i] = (it->isValid() && it->LocalIndex() == next_index);
+        if (m_is_active[i] && m_current_index < 0) {
+            m_current_index = next_index;
+            m_grid_index = it->index();
+            m_tilebox = it->tilebox();
+        }
+    }
+}
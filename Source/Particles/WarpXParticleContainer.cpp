@@ -17,6 +17,7 @@
 #include "Fields.H"
 #include "Pusher/GetAndSetPosition.H"
 #include "Pusher/UpdatePosition.H"
+#include "Sorting/SortingUtils.H"
 #include "ParticleBoundaries_K.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
@@ -29,12 +30,14 @@
 #include <ablastr/utils/Communication.H>
 
 #include <AMReX.H>
+#include <AMReX_Algorithm.H>
 #include <AMReX_AmrCore.H>
 #include <AMReX_AmrParGDB.H>
 #include <AMReX_BLassert.H>
 #include <AMReX_Box.H>
 #include <AMReX_BoxArray.H>
 #include <AMReX_Config.H>
+#include <AMReX_DenseBins.H>
 #include <AMReX_Dim3.H>
 #include <AMReX_Extension.H>
 #include <AMReX_FabArray.H>
@@ -49,6 +52,7 @@
 #include <AMReX_IntVect.H>
 #include <AMReX_LayoutData.H>
 #include <AMReX_MFIter.H>
+#include <AMReX_Math.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_PODVector.H>
 #include <AMReX_ParGDB.H>
@@ -73,6 +77,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 using namespace amrex;
 
@@ -80,12 +85,69 @@ WarpXParIter::WarpXParIter (ContainerType& pc, int level)
     : amrex::ParIterSoA<PIdx::nattribs, 0>(pc, level,
              MFItInfo().SetDynamic(WarpX::do_dynamic_scheduling))
 {
+    OrderTilesByCost(WarpX::do_dynamic_scheduling);
 }
 
 WarpXParIter::WarpXParIter (ContainerType& pc, int level, MFItInfo& info)
     : amrex::ParIterSoA<PIdx::nattribs, 0>(pc, level,
                    info.SetDynamic(WarpX::do_dynamic_scheduling))
 {
+    OrderTilesByCost(WarpX::do_dynamic_scheduling);
+}
+
+WarpXParIter::WarpXParIter (ContainerType& pc, int level, MFItInfo& info, bool dynamic_scheduling)
+    : amrex::ParIterSoA<PIdx::nattribs, 0>(pc, level, info.SetDynamic(dynamic_scheduling))
+{
+    OrderTilesByCost(dynamic_scheduling);
+}
+
+void
+WarpXParIter::OrderTilesByCost (bool dynamic_scheduling)
+{
+#ifdef AMREX_USE_OMP
+    // With static scheduling, each thread has its own range of tiles: nothing to balance
+    if (!dynamic_scheduling || !WarpX::do_cost_ordered_scheduling || omp_get_num_threads() == 1) { return; }
+
+    // With dynamic scheduling, every thread holds the list of all the tiles that contain
+    // particles (m_particle_tiles, and their indices in m_valid_index, followed by padding),
+    // and the threads pick the next entry of the list with a shared atomic counter.
+    // The list is sorted by decreasing number of particles, which is the cost estimate of
+    // a tile for a given species (the cost per particle, e.g. from the shape order, is the
+    // same for all its tiles).
+    const auto ntiles = static_cast<int>(m_particle_tiles.size());
+    if (ntiles < 2) { return; }
+
+    // All the threads must use the same order, otherwise tiles would be skipped or
+    // processed twice. It is computed once from a snapshot of the particle numbers and
+    // broadcast to the other threads; the implicit barrier at the end of the single
+    // construct also prevents a thread from modifying tiles (e.g. adding the products of
+    // a collision to this species) while the numbers of particles are being read.
+    amrex::Vector<int> order;
+#pragma omp single copyprivate(order)
+    {
+        amrex::Vector<amrex::Long> num_particles(ntiles);
+        for (int i = 0; i < ntiles; ++i) {
+            num_particles[i] = m_particle_tiles[i]->numParticles();
+        }
+        order.resize(ntiles);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&] (int a, int b) {
+            return num_particles[a] > num_particles[b];
+        });
+    }
+
+    const amrex::Vector<int> valid_index(m_valid_index.begin(), m_valid_index.begin() + ntiles);
+    const auto particle_tiles = m_particle_tiles;
+    for (int i = 0; i < ntiles; ++i) {
+        m_valid_index[i] = valid_index[order[i]];
+        m_particle_tiles[i] = particle_tiles[order[i]];
+    }
+
+    // The first tile of this thread has changed
+    currentIndex = m_valid_index[m_pariter_index];
+#else
+    amrex::ignore_unused(dynamic_scheduling);
+#endif
 }
 
 WarpXParticleContainer::WarpXParticleContainer (AmrCore* amr_core, int ispecies)
@@ -120,6 +182,7 @@ WarpXParticleContainer::WarpXParticleContainer (AmrCore* amr_core, int ispecies)
     local_jx.resize(num_threads);
     local_jy.resize(num_threads);
     local_jz.resize(num_threads);
+    local_interleaved_fields.resize(num_threads);
 
     // The boundary conditions are read in in ReadBCParams but a child class
     // can allow these value to be overwritten if different boundary
@@ -328,6 +391,87 @@ WarpXParticleContainer::deleteInvalidParticles () {
     }
 }
 
+bool
+WarpXParticleContainer::ParticlesWithinGridGhostCells (int num_ghost)
+{
+    constexpr int lev = 0;
+    const Geometry& geom = Geom(lev);
+    const auto plo = geom.ProbLoArray();
+    const auto dxi = geom.InvCellSizeArray();
+    const Box domain = geom.Domain();
+
+    ReduceOps<ReduceOpMax> reduce_op;
+    ReduceData<int> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+    for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
+    {
+        const Box halo_box = amrex::grow(pti.validbox(), num_ghost);
+        const auto ptd = pti.GetParticleTile().getConstParticleTileData();
+
+        reduce_op.eval(pti.numParticles(), reduce_data,
+            [=] AMREX_GPU_DEVICE (int ip) -> ReduceTuple
+            {
+                // Invalid particles are removed by Redistribute, wherever they are
+                if (!amrex::ParticleIDWrapper{ptd.m_idcpu[ip]}.is_valid()) { return 0; }
+                const IntVect iv = amrex::getParticleCell(ptd, ip, plo, dxi, domain);
+                return halo_box.contains(iv) ? 0 : 1;
+            });
+    }
+
+    return get<0>(reduce_data.value()) == 0;
+}
+
+void
+WarpXParticleContainer::SortParticlesByMortonBin (const amrex::IntVect& bin_size)
+{
+    WARPX_PROFILE("WarpXParticleContainer::SortParticlesByMortonBin()");
+
+    using ParticleBins = amrex::DenseBins<ParticleTileType::ParticleTileDataType>;
+
+    for (int lev = 0; lev <= finestLevel(); ++lev) {
+        const Geometry& geom = Geom(lev);
+        const auto plo = geom.ProbLoArray();
+        const auto dxi = geom.InvCellSizeArray();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti) {
+            const auto np = pti.numParticles();
+            if (np == 0) { continue; }
+
+            const Box& tbx = pti.tilebox();
+            const IntVect lo = tbx.smallEnd();
+            const IntVect nbins_dir = (tbx.length() + bin_size - 1) / bin_size;
+            IntVect nbits;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                nbits[idim] = numBitsFor(nbins_dir[idim]);
+            }
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(nbits.sum() < 31,
+                "Too many bins per tile for the Morton sorting; increase warpx.sort_bin_size");
+            const int nbins = 1 << nbits.sum();
+
+            auto& ptile = pti.GetParticleTile();
+            ParticleBins bins;
+            bins.build(np, ptile.getParticleTileData(), nbins,
+                [=] AMREX_GPU_DEVICE (ParticleType const & p) noexcept -> unsigned int
+                {
+                    IntVect bin;
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        const int cell = static_cast<int>(
+                            amrex::Math::floor((p.pos(idim)-plo[idim])*dxi[idim])) - lo[idim];
+                        // Particles slightly outside of the tile are put in the closest bin
+                        bin[idim] = amrex::Clamp(cell/bin_size[idim], 0, nbins_dir[idim]-1);
+                    }
+                    return mortonBinIndex(bin, nbits);
+                });
+
+            ReorderParticles(lev, pti, bins.permutationPtr());
+        }
+    }
+}
+
 /* \brief Current Deposition for thread thread_num
  * \param pti         Particle iterator
  * \param wp          Array of particle weights
@@ -452,22 +596,29 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
     tby.grow(ng_J);
     tbz.grow(ng_J);
 
-    // CPU, tiling: j<xyz>_arr point to the local_j<xyz>[thread_num] arrays
-    local_jx[thread_num].resize(tbx, jx->nComp());
-    local_jy[thread_num].resize(tby, jy->nComp());
-    local_jz[thread_num].resize(tbz, jz->nComp());
-
-    // local_jx[thread_num] is set to zero
-    local_jx[thread_num].setVal(0.0);
-    local_jy[thread_num].setVal(0.0);
-    local_jz[thread_num].setVal(0.0);
-
-    auto & jx_fab = local_jx[thread_num];
-    auto & jy_fab = local_jy[thread_num];
-    auto & jz_fab = local_jz[thread_num];
-    Array4<Real> const& jx_arr = local_jx[thread_num].array();
-    Array4<Real> const& jy_arr = local_jy[thread_num].array();
-    Array4<Real> const& jz_arr = local_jz[thread_num].array();
+    // CPU, tiling: j<xyz>_arr point to the local_j<xyz>[thread_num] arrays,
+    // or to the tile-local arrays shared with the other species
+    const bool use_shared_buffers = (m_shared_tile_current != nullptr) && (lev == depos_lev);
+    auto & jx_fab = use_shared_buffers ? m_shared_tile_current->jx[thread_num] : local_jx[thread_num];
+    auto & jy_fab = use_shared_buffers ? m_shared_tile_current->jy[thread_num] : local_jy[thread_num];
+    auto & jz_fab = use_shared_buffers ? m_shared_tile_current->jz[thread_num] : local_jz[thread_num];
+
+    if (use_shared_buffers) {
+        AMREX_ASSERT(jx_fab.box() == tbx && jy_fab.box() == tby && jz_fab.box() == tbz);
+    } else {
+        jx_fab.resize(tbx, jx->nComp());
+        jy_fab.resize(tby, jy->nComp());
+        jz_fab.resize(tbz, jz->nComp());
+
+        // local_jx[thread_num] is set to zero
+        jx_fab.setVal(0.0);
+        jy_fab.setVal(0.0);
+        jz_fab.setVal(0.0);
+    }
+
+    Array4<Real> const& jx_arr = jx_fab.array();
+    Array4<Real> const& jy_arr = jy_fab.array();
+    Array4<Real> const& jz_arr = jz_fab.array();
 #endif
 
     const auto GetPosition = GetParticlePosition<PIdx>(pti, offset);
@@ -833,11 +984,14 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
 
 #ifndef AMREX_USE_GPU
     // CPU, tiling: atomicAdd local_j<xyz> into j<xyz>
-    WARPX_PROFILE_VAR_START(blp_accumulate);
-    (*jx)[pti].lockAdd(local_jx[thread_num], tbx, tbx, 0, 0, jx->nComp());
-    (*jy)[pti].lockAdd(local_jy[thread_num], tby, tby, 0, 0, jy->nComp());
-    (*jz)[pti].lockAdd(local_jz[thread_num], tbz, tbz, 0, 0, jz->nComp());
-    WARPX_PROFILE_VAR_STOP(blp_accumulate);
+    // (the shared buffers are added by their owner, after all the species have deposited)
+    if (!use_shared_buffers) {
+        WARPX_PROFILE_VAR_START(blp_accumulate);
+        (*jx)[pti].lockAdd(jx_fab, tbx, tbx, 0, 0, jx->nComp());
+        (*jy)[pti].lockAdd(jy_fab, tby, tby, 0, 0, jy->nComp());
+        (*jz)[pti].lockAdd(jz_fab, tbz, tbz, 0, 0, jz->nComp());
+        WARPX_PROFILE_VAR_STOP(blp_accumulate);
+    }
 #endif
 }
 
@@ -860,21 +1014,8 @@ WarpXParticleContainer::DepositCurrent (
 #endif
         for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
         {
-            const long np = pti.numParticles();
-            const auto & wp = pti.GetAttribs(PIdx::w);
-            const auto & uxp = pti.GetAttribs(PIdx::ux);
-            const auto & uyp = pti.GetAttribs(PIdx::uy);
-            const auto & uzp = pti.GetAttribs(PIdx::uz);
-
-            int* AMREX_RESTRICT ion_lev = nullptr;
-            if (do_field_ionization)
-            {
-                ion_lev = pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr();
-            }
-
-            DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev,
-                           J[lev][0], J[lev][1], J[lev][2],
-                           0, np, thread_num, lev, lev, dt, relative_time, PushType::Explicit);
+            DepositCurrentInTile(pti, J[lev][0], J[lev][1], J[lev][2],
+                                 thread_num, lev, dt, relative_time);
         }
 #ifdef AMREX_USE_OMP
         }
@@ -882,6 +1023,28 @@ WarpXParticleContainer::DepositCurrent (
     }
 }
 
+void
+WarpXParticleContainer::DepositCurrentInTile (
+    WarpXParIter& pti,
+    amrex::MultiFab* jx, amrex::MultiFab* jy, amrex::MultiFab* jz,
+    int thread_num, int lev, amrex::Real dt, amrex::Real relative_time)
+{
+    const long np = pti.numParticles();
+    const auto & wp = pti.GetAttribs(PIdx::w);
+    const auto & uxp = pti.GetAttribs(PIdx::ux);
+    const auto & uyp = pti.GetAttribs(PIdx::uy);
+    const auto & uzp = pti.GetAttribs(PIdx::uz);
+
+    int* AMREX_RESTRICT ion_lev = nullptr;
+    if (do_field_ionization)
+    {
+        ion_lev = pti.GetiAttribs(particle_icomps["ionizationLevel"]).dataPtr();
+    }
+
+    DepositCurrent(pti, wp, uxp, uyp, uzp, ion_lev, jx, jy, jz,
+                   0, np, thread_num, lev, lev, dt, relative_time, PushType::Explicit);
+}
+
 /* \brief Charge Deposition for thread thread_num
  * \param pti         Particle iterator
  * \param wp          Array of particle weights
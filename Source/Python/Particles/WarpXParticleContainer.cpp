@@ -4,6 +4,7 @@
  * License: BSD-3-Clause-LBNL
  */
 
+#include "Python/callbacks.H"
 #include "Python/pyWarpX.H"
 
 #include <Particles/WarpXParticleContainer.H>
@@ -77,6 +78,9 @@ void init_WarpXParticleContainer (py::module& m)
                     lev, n, xp, yp, zp, uxp, uyp, uzp, nattr_real, attr,
                     nattr_int, iattr, uniqueparticles, id
                 );
+
+                // The particle arrays may have been reallocated
+                InvalidateParticleDataViews();
             },
             py::arg("lev"), py::arg("n"),
             py::arg("x"), py::arg("y"), py::arg("z"),
@@ -101,6 +105,18 @@ void init_WarpXParticleContainer (py::module& m)
             },
             py::arg("comp_name")
         )
+        .def_property_readonly("real_comp_names",
+            [](WarpXParticleContainer& pc)
+            {
+                return pc.getParticleComps();
+            }
+        )
+        .def_property_readonly("int_comp_names",
+            [](WarpXParticleContainer& pc)
+            {
+                return pc.getParticleiComps();
+            }
+        )
         .def("num_local_tiles_at_level",
             &WarpXParticleContainer::numLocalTilesAtLevel,
             py::arg("level")
@@ -8,46 +8,157 @@
  */
 #include "callbacks.H"
 
+#include <AMReX_ParallelDescriptor.H>
+
 #include <cstdlib>
 #include <exception>
+#include <functional>
 #include <iostream>
+#include <string>
+#include <utility>
+
+
+std::map< std::string, PythonCallbackHandle > warpx_callback_py_map;
 
+namespace
+{
+    std::uint64_t particle_data_generation = 0;
+    int python_callback_step = 0;
+
+    /** Slots of the callbacks, the first ones being the built-in locations */
+    std::vector<PythonCallbackSlot>& Slots ()
+    {
+        static std::vector<PythonCallbackSlot> slots = [] () {
+            std::vector<PythonCallbackSlot> builtin_slots;
+            for (const auto& name : amrex::getEnumNameStrings<PythonCallbackLocation>()) {
+                warpx_callback_py_map[name] = static_cast<PythonCallbackHandle>(builtin_slots.size());
+                builtin_slots.emplace_back();
+                builtin_slots.back().name = name;
+            }
+            return builtin_slots;
+        }();
+        return slots;
+    }
+}
+
+PythonCallbackHandle GetPythonCallbackHandle ( const std::string& name )
+{
+    auto& slots = Slots();
+    const auto it = warpx_callback_py_map.find(name);
+    if (it != warpx_callback_py_map.end()) { return it->second; }
+
+    const auto handle = static_cast<PythonCallbackHandle>(slots.size());
+    slots.emplace_back();
+    slots.back().name = name;
+    warpx_callback_py_map[name] = handle;
+    return handle;
+}
 
-std::map< std::string, std::function<void()> > warpx_callback_py_map;
+const std::vector<PythonCallbackSlot>& GetPythonCallbackSlots ()
+{
+    return Slots();
+}
 
 void InstallPythonCallback ( const std::string& name, std::function<void()> callback )
 {
-    warpx_callback_py_map[name] = std::move(callback);
+    Slots()[GetPythonCallbackHandle(name)].callback = std::move(callback);
+}
+
+bool IsPythonCallbackInstalled ( PythonCallbackHandle handle )
+{
+    return static_cast<bool>(Slots()[handle].callback);
+}
+
+bool IsPythonCallbackInstalled ( PythonCallbackLocation location )
+{
+    return IsPythonCallbackInstalled(static_cast<PythonCallbackHandle>(location));
 }
 
 bool IsPythonCallbackInstalled ( const std::string& name )
 {
-    return (warpx_callback_py_map.count(name) == 1u);
+    Slots();
+    const auto it = warpx_callback_py_map.find(name);
+    return (it != warpx_callback_py_map.end()) && IsPythonCallbackInstalled(it->second);
 }
 
-// Execute Python callbacks of the type given by the input string
-void ExecutePythonCallback ( const std::string& name )
+// Execute Python callbacks of the slot given by the handle
+void ExecutePythonCallback ( PythonCallbackHandle handle )
 {
-    if ( IsPythonCallbackInstalled(name) ) {
-        WARPX_PROFILE("warpx_py_" + name);
-        try {
-            warpx_callback_py_map[name]();
-        } catch (std::exception &e) {
-            std::cerr << "Python callback '" << name << "' failed!" << std::endl;
-            std::cerr << e.what() << std::endl;
-            std::exit(3);  // note: NOT amrex::Abort(), to avoid hangs with MPI
-
-            // future note:
-            // if we want to rethrow/raise exceptions from Python callbacks through here (C++) and
-            // back the managing Python interpreter, we first need to discard and clear
-            // out the Python error in py::error_already_set. Otherwise, MPI-runs will hang
-            // (and Python will be in continued error state).
-            // https://pybind11.readthedocs.io/en/stable/advanced/exceptions.html#handling-unraisable-exceptions
-        }
+    // The particles may have been moved since the previous callback
+    InvalidateParticleDataViews();
+
+    // The callback may install new callbacks (which may reallocate the slots)
+    // or clear itself, so the slot is not referenced while the callback runs
+    std::function<void()> callback;
+    std::string name;
+    {
+        const auto& slot = Slots()[handle];
+        if ( !slot.callback ) { return; }
+        if ( slot.use_intervals && !slot.intervals.contains(python_callback_step) ) { return; }
+        callback = slot.callback;
+        name = slot.name;
+    }
+
+    WARPX_PROFILE("warpx_py_" + name);
+    const double start_time = amrex::ParallelDescriptor::second();
+    try {
+        callback();
+    } catch (std::exception &e) {
+        std::cerr << "Python callback '" << name << "' failed!" << std::endl;
+        std::cerr << e.what() << std::endl;
+        std::exit(3);  // note: NOT amrex::Abort(), to avoid hangs with MPI
+
+        // future note:
+        // if we want to rethrow/raise exceptions from Python callbacks through here (C++) and
+        // back the managing Python interpreter, we first need to discard and clear
+        // out the Python error in py::error_already_set. Otherwise, MPI-runs will hang
+        // (and Python will be in continued error state).
+        // https://pybind11.readthedocs.io/en/stable/advanced/exceptions.html#handling-unraisable-exceptions
     }
+    auto& slot = Slots()[handle];
+    slot.time += amrex::ParallelDescriptor::second() - start_time;
+    ++slot.ncalls;
+
+    // The views created in the callback must not be used once WarpX resumes
+    InvalidateParticleDataViews();
+}
+
+void ExecutePythonCallback ( PythonCallbackLocation location )
+{
+    ExecutePythonCallback(static_cast<PythonCallbackHandle>(location));
+}
+
+void ExecutePythonCallback ( const std::string& name )
+{
+    ExecutePythonCallback(GetPythonCallbackHandle(name));
 }
 
 void ClearPythonCallback ( const std::string& name )
 {
-    warpx_callback_py_map.erase(name);
+    Slots();
+    const auto it = warpx_callback_py_map.find(name);
+    if (it != warpx_callback_py_map.end()) { Slots()[it->second].callback = nullptr; }
+}
+
+void SetPythonCallbackIntervals ( const std::string& name, const std::vector<std::string>& intervals )
+{
+    auto& slot = Slots()[GetPythonCallbackHandle(name)];
+    slot.use_intervals = !intervals.empty();
+    slot.intervals = slot.use_intervals ?
+        utils::parser::IntervalsParser(intervals) : utils::parser::IntervalsParser();
+}
+
+void SetPythonCallbackStep ( int step )
+{
+    python_callback_step = step;
+}
+
+std::uint64_t GetParticleDataGeneration ()
+{
+    return particle_data_generation;
+}
+
+void InvalidateParticleDataViews ()
+{
+    ++particle_data_generation;
 }
@@ -130,5 +130,22 @@ PYBIND11_MODULE(PYWARPX_MODULE_NAME, m) {
     // Expose the python callback function installation and removal functions
     m.def("add_python_callback", &InstallPythonCallback);
     m.def("remove_python_callback", &ClearPythonCallback);
-    m.def("execute_python_callback", &ExecutePythonCallback, py::arg("name"));
+    m.def("execute_python_callback",
+        py::overload_cast< const std::string& >(&ExecutePythonCallback), py::arg("name"));
+    m.def("set_python_callback_intervals", &SetPythonCallbackIntervals,
+        py::arg("name"), py::arg("intervals"),
+        "Restricts the execution of the callbacks of a location to the given steps "
+        "(empty list to remove the restriction)");
+    m.def("get_python_callback_timers",
+        [] () {
+            std::map<std::string, std::pair<double, amrex::Long>> timers;
+            for (const auto& slot : GetPythonCallbackSlots()) {
+                timers[slot.name] = {slot.time, slot.ncalls};
+            }
+            return timers;
+        },
+        "Wall time (in seconds) spent in and number of calls of the callbacks of each location on this process");
+
+    // Expose the generation of the particle data, used to detect invalid views of the particle arrays
+    m.def("get_particle_data_generation", &GetParticleDataGeneration);
 }
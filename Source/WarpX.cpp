@@ -11,6 +11,7 @@
  */
 #include "WarpX.H"
 
+#include "BoundaryConditions/CPML.H"
 #include "BoundaryConditions/PEC_Insulator.H"
 #include "BoundaryConditions/PML.H"
 #include "Diagnostics/MultiDiagnostics.H"
@@ -162,6 +163,7 @@ bool WarpX::refine_plasma     = false;
 
 utils::parser::IntervalsParser WarpX::sort_intervals;
 amrex::IntVect WarpX::sort_bin_size(AMREX_D_DECL(1,1,1));
+SortBinOrder WarpX::sort_bin_order = SortBinOrder::Default;
 
 #if defined(AMREX_USE_CUDA)
 bool WarpX::sort_particles_for_deposition = true;
@@ -172,6 +174,7 @@ bool WarpX::sort_particles_for_deposition = false;
 amrex::IntVect WarpX::sort_idx_type(AMREX_D_DECL(0,0,0));
 
 bool WarpX::do_dynamic_scheduling = true;
+bool WarpX::do_cost_ordered_scheduling = false;
 
 bool WarpX::do_multi_J = false;
 int WarpX::do_multi_J_n_depositions;
@@ -276,6 +279,11 @@ WarpX::WarpX ()
 
     ablastr::utils::SignalHandling::InitSignalHandling();
 
+    // The indices of the region timers are the values of TimingRegion
+    for (const auto& name : amrex::getEnumNameStrings<TimingRegion>()) {
+        m_region_timers.get_region(name);
+    }
+
     // Geometry on all levels has been defined already.
     // No valid BoxArray and DistributionMapping have been defined.
     // But the arrays for them have been resized.
@@ -867,6 +875,9 @@ WarpX::ReadParameters ()
 
         utils::parser::queryWithParser(pp_warpx, "pml_ncell", pml_ncell);
         utils::parser::queryWithParser(pp_warpx, "pml_delta", pml_delta);
+        utils::parser::queryWithParser(pp_warpx, "cpml_ncell", cpml_ncell);
+        utils::parser::queryWithParser(pp_warpx, "cpml_order", cpml_order);
+        utils::parser::queryWithParser(pp_warpx, "cpml_reflection", cpml_reflection);
         pp_warpx.query("pml_has_particles", pml_has_particles);
         pp_warpx.query("do_pml_j_damping", do_pml_j_damping);
         pp_warpx.query("do_pml_in_domain", do_pml_in_domain);
@@ -992,6 +1003,7 @@ WarpX::ReadParameters ()
         }
 
         pp_warpx.query("do_dynamic_scheduling", do_dynamic_scheduling);
+        pp_warpx.query("do_cost_ordered_scheduling", do_cost_ordered_scheduling);
 
         // Integer that corresponds to the type of grid used in the simulation
         // (collocated, staggered, hybrid)
@@ -1242,6 +1254,26 @@ WarpX::ReadParameters ()
             }
         }
 
+        // Memory layout of the fields read by the gather of the particle push
+        pp_algo.query("field_gathering_interleaved", field_gathering_interleaved);
+        pp_algo.query("field_gathering_shared_buffers", field_gathering_shared_buffers);
+        if (field_gathering_shared_buffers) { field_gathering_interleaved = true; }
+#ifdef AMREX_USE_GPU
+        // On GPU, the gather kernels of successive tiles run asynchronously on different
+        // streams: repacking a buffer for the next tile could overwrite (or reallocate) it
+        // while the previous kernel still reads it. The device caches do not benefit from
+        // the interleaved layout in the same way anyway.
+        if (field_gathering_interleaved) {
+            ablastr::warn_manager::WMRecordWarning(
+                "Algorithms",
+                "algo.field_gathering_interleaved and algo.field_gathering_shared_buffers "
+                "are ignored on GPU.",
+                ablastr::warn_manager::WarnPriority::low);
+        }
+        field_gathering_interleaved = false;
+        field_gathering_shared_buffers = false;
+#endif
+
         // Use same shape factors in all directions
         // - with momentum-conserving field gathering
         if (field_gathering_algo == GatheringAlgo::MomentumConserving) {galerkin_interpolation = false;}
@@ -1276,6 +1308,32 @@ WarpX::ReadParameters ()
                                       macroscopic_solver_algo, "-_");
         }
 
+        pp_algo.query("fdtd_temporal_blocking", fdtd_temporal_blocking);
+        utils::parser::queryWithParser(pp_algo, "fdtd_block_size", fdtd_block_size);
+        if (fdtd_temporal_blocking) {
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                evolve_scheme == EvolveScheme::Explicit &&
+                (electromagnetic_solver_id == ElectromagneticSolverAlgo::Yee ||
+                 electromagnetic_solver_id == ElectromagneticSolverAlgo::CKC) &&
+                grid_type != GridType::Collocated,
+                "algo.fdtd_temporal_blocking requires the explicit scheme with the Yee or CKC solver on a staggered grid");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                em_solver_medium == MediumForEM::Vacuum && !EB::enabled() && max_level == 0 &&
+                !do_dive_cleaning && !do_divb_cleaning && !use_hybrid_QED,
+                "algo.fdtd_temporal_blocking is not supported with macroscopic media, embedded boundaries,"
+                " mesh refinement, divergence cleaning or hybrid QED");
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                    field_boundary_lo[idim] == FieldBoundaryType::Periodic &&
+                    field_boundary_hi[idim] == FieldBoundaryType::Periodic,
+                    "algo.fdtd_temporal_blocking requires periodic field boundaries");
+            }
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                fdtd_block_size >= FiniteDifferenceSolver::temporal_blocking_halo,
+                "algo.fdtd_block_size must be at least "
+                + std::to_string(FiniteDifferenceSolver::temporal_blocking_halo));
+        }
+
         if (evolve_scheme == EvolveScheme::SemiImplicitEM ||
             evolve_scheme == EvolveScheme::ThetaImplicitEM ||
             evolve_scheme == EvolveScheme::StrangImplicitSpectralEM) {
@@ -1400,6 +1458,8 @@ WarpX::ReadParameters ()
             }
         }
 
+        pp_warpx.query_enum_sloppy("sort_bin_order", sort_bin_order, "-_");
+
         pp_warpx.query("sort_particles_for_deposition",sort_particles_for_deposition);
         Vector<int> vect_sort_idx_type(AMREX_SPACEDIM,0);
         const bool sort_idx_type_is_specified =
@@ -2087,6 +2147,13 @@ WarpX::AllocLevelData (int lev, const BoxArray& ba, const DistributionMapping& d
         use_filter,
         bilinear_filter.stencil_length_each_dir);
 
+    // The temporally blocked FDTD update recomputes E and B in a halo around
+    // each block, and E in the first guard cell (where it uses J)
+    if (fdtd_temporal_blocking) {
+        guard_cells.ng_alloc_EB.max(IntVect(FiniteDifferenceSolver::temporal_blocking_halo));
+        guard_cells.ng_alloc_J.max(IntVect(1));
+    }
+
 #ifdef AMREX_USE_EB
     bool const eb_enabled = EB::enabled();
     if (eb_enabled) {
@@ -0,0 +1,72 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "RegionTimers.H"
+
+#include "ablastr/utils/TextMsg.H"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace ablastr::utils::timer;
+
+int
+RegionTimers::get_region (const std::string& name)
+{
+    const auto it = std::find(m_names.begin(), m_names.end(), name);
+    if (it != m_names.end()) {
+        return static_cast<int>(std::distance(m_names.begin(), it));
+    }
+    m_names.push_back(name);
+    m_durations.push_back(0.0);
+    m_depth.push_back(0);
+    return static_cast<int>(m_names.size()) - 1;
+}
+
+void
+RegionTimers::start (int region)
+{
+    if (m_depth[region]++ > 0) { return; }
+
+    pause_active_region();
+    m_active.push_back(region);
+}
+
+void
+RegionTimers::stop (int region)
+{
+    if (--m_depth[region] > 0) { return; }
+
+    ABLASTR_ALWAYS_ASSERT_WITH_MESSAGE(
+        !m_active.empty() && m_active.back() == region,
+        "RegionTimers: the region " + m_names[region] + " is not the innermost active region");
+
+    pause_active_region();
+    m_active.pop_back();
+}
+
+void
+RegionTimers::pause_active_region ()
+{
+    m_timer.record_stop_time();
+    if (!m_active.empty()) {
+        m_durations[m_active.back()] += m_timer.get_duration();
+    }
+    // Start timing the (new) innermost active region
+    m_timer.record_start_time();
+}
+
+ScopedRegion::ScopedRegion (RegionTimers& timers, int region):
+    m_timers{timers}, m_region{region}
+{
+    m_timers.start(m_region);
+}
+
+ScopedRegion::~ScopedRegion ()
+{
+    m_timers.stop(m_region);
+}
@@ -0,0 +1,170 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "Benchmark.H"
+
+#include <AMReX_GpuDevice.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace
+{
+    struct RegisteredBenchmark
+    {
+        std::string name;
+        std::string unit;
+        std::function<void(warpx::bench::State&)> func;
+    };
+
+    std::vector<RegisteredBenchmark>& Registry ()
+    {
+        static std::vector<RegisteredBenchmark> registry;
+        return registry;
+    }
+
+    /** Precision of the fields and of the particles, e.g. "DP_PDP" */
+    std::string PrecisionSuffix ()
+    {
+        const std::string field_precision = sizeof(amrex::Real) == sizeof(double) ? "DP" : "SP";
+        const std::string particle_precision = sizeof(amrex::ParticleReal) == sizeof(double) ? "PDP" : "PSP";
+        return field_precision + "_" + particle_precision;
+    }
+}
+
+namespace warpx::bench
+{
+    State::State (int min_iterations, double min_time)
+        : m_min_iterations{min_iterations}, m_min_time{min_time}
+    {}
+
+    bool
+    State::KeepRunning ()
+    {
+        amrex::Gpu::streamSynchronize();
+        const double now = amrex::ParallelDescriptor::second();
+
+        if (!m_warmup_done) {
+            // Run the warm-up iteration
+            m_warmup_done = true;
+            return true;
+        }
+        if (m_iterations < 0) {
+            // The warm-up iteration is done: start the timer
+            m_iterations = 0;
+            m_start_time = now;
+            return true;
+        }
+
+        ++m_iterations;
+        m_elapsed_time = now - m_start_time;
+        return m_iterations < m_min_iterations || m_elapsed_time < m_min_time;
+    }
+
+    void
+    RegisterBenchmark (const std::string& name, const std::string& unit,
+                       std::function<void(State&)> func)
+    {
+        Registry().push_back(RegisteredBenchmark{name, unit, std::move(func)});
+    }
+
+    std::vector<Result>
+    RunBenchmarks (const std::string& filter, int min_iterations, double min_time)
+    {
+        std::vector<Result> results;
+        for (const auto& benchmark : Registry()) {
+            if (benchmark.name.find(filter) == std::string::npos) { continue; }
+
+            State state(min_iterations, min_time);
+            benchmark.func(state);
+
+            Result result;
+            result.name = benchmark.name + "/" + PrecisionSuffix();
+            result.unit = benchmark.unit;
+            result.iterations = state.Iterations();
+            if (state.Iterations() > 0) {
+                result.time_per_iteration = state.ElapsedTime()/state.Iterations();
+                result.throughput = static_cast<double>(state.ItemsPerIteration())/result.time_per_iteration;
+            }
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    void
+    PrintResults (const std::vector<Result>& results)
+    {
+        amrex::Print() << std::left << std::setw(48) << "benchmark"
+                       << std::right << std::setw(12) << "iterations"
+                       << std::setw(16) << "time/iter (s)"
+                       << std::setw(16) << "throughput" << "\n";
+        for (const auto& r : results) {
+            amrex::Print() << std::left << std::setw(48) << r.name
+                           << std::right << std::setw(12) << r.iterations
+                           << std::setw(16) << std::scientific << std::setprecision(4) << r.time_per_iteration
+                           << std::setw(16) << r.throughput << std::defaultfloat
+                           << " " << r.unit << "/s\n";
+        }
+    }
+
+    std::map<std::string, double>
+    ReadBaseline (const std::string& filename)
+    {
+        std::map<std::string, double> baseline;
+        std::ifstream ifs(filename);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            if (line.empty() || line[0] == '#') { continue; }
+            std::istringstream iss(line);
+            std::string name;
+            double throughput = 0.;
+            if (iss >> name >> throughput) { baseline[name] = throughput; }
+        }
+        return baseline;
+    }
+
+    void
+    WriteBaseline (const std::string& filename, const std::vector<Result>& results)
+    {
+        if (!amrex::ParallelDescriptor::IOProcessor()) { return; }
+
+        // Merge with the existing baseline, so that the file can be updated benchmark by benchmark
+        auto baseline = ReadBaseline(filename);
+        for (const auto& r : results) { baseline[r.name] = r.throughput; }
+
+        std::ofstream ofs(filename, std::ofstream::out);
+        ofs << "# benchmark throughput(items/s)\n";
+        ofs << std::scientific << std::setprecision(6);
+        for (const auto& [name, throughput] : baseline) {
+            ofs << name << " " << throughput << "\n";
+        }
+    }
+
+    int
+    CompareToBaseline (const std::vector<Result>& results,
+                       const std::map<std::string, double>& baseline, double tolerance)
+    {
+        int num_regressions = 0;
+        for (const auto& r : results) {
+            const auto it = baseline.find(r.name);
+            if (it == baseline.end() || it->second <= 0.) { continue; }
+
+            const double ratio = r.throughput/it->second;
+            const bool is_regression = ratio < 1. - tolerance;
+            if (is_regression) { ++num_regressions; }
+            amrex::Print() << std::left << std::setw(48) << r.name
+                           << std::right << std::fixed << std::setprecision(3)
+                           << std::setw(10) << ratio << std::defaultfloat
+                           << (is_regression ? "  REGRESSION" : "") << "\n";
+        }
+        return num_regressions;
+    }
+}
@@ -0,0 +1,197 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "Benchmark.H"
+#include "BenchmarkList.H"
+#include "SyntheticData.H"
+
+#include "EmbeddedBoundary/WarpXFaceInfoBox.H"
+#include "Fields.H"
+#include "FieldSolver/FiniteDifferenceSolver/FiniteDifferenceSolver.H"
+#ifdef WARPX_USE_FFT
+#   include "FieldSolver/SpectralSolver/SpectralFieldData.H"
+#   include "FieldSolver/SpectralSolver/SpectralSolver.H"
+#endif
+#include "Utils/WarpXAlgorithmSelection.H"
+#include "Utils/WarpXConst.H"
+
+#include <ablastr/fields/MultiFabRegister.H>
+#include <ablastr/utils/Enums.H>
+
+#include <AMReX_BoxArray.H>
+#include <AMReX_DistributionMapping.H>
+#include <AMReX_IntVect.H>
+#include <AMReX_LayoutData.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_RealVect.H>
+#include <AMReX_Vector.H>
+#include <AMReX_iMultiFab.H>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+using namespace amrex::literals;
+
+namespace
+{
+    using warpx::bench::State;
+    using warpx::fields::FieldType;
+    using ablastr::fields::Direction;
+
+    /** E, B and J on a single box, allocated with the Yee staggering */
+    struct SyntheticFields
+    {
+        SyntheticFields (int ncell, int nguard)
+            : ba{amrex::Box(amrex::IntVect(0), amrex::IntVect(ncell - 1))}, dm{ba}
+        {
+            for (int dir = 0; dir < 3; ++dir) {
+                const amrex::IntVect ng(nguard);
+                fields.alloc_init(FieldType::Efield_fp, Direction{dir}, 0,
+                    amrex::convert(ba, warpx::bench::YeeEType(dir)), dm, 1, ng, 1._rt);
+                fields.alloc_init(FieldType::Bfield_fp, Direction{dir}, 0,
+                    amrex::convert(ba, warpx::bench::YeeBType(dir)), dm, 1, ng, 1.e-8_rt);
+                fields.alloc_init(FieldType::current_fp, Direction{dir}, 0,
+                    amrex::convert(ba, warpx::bench::YeeEType(dir)), dm, 1, ng, 0._rt);
+            }
+        }
+
+        amrex::BoxArray ba;
+        amrex::DistributionMapping dm;
+        ablastr::fields::MultiFabRegister fields;
+    };
+
+    /** Time step at half the Courant limit */
+    amrex::Real TimeStep (const std::array<amrex::Real,3>& dx)
+    {
+        return 0.5_rt*std::min({dx[0], dx[1], dx[2]})/PhysConst::c;
+    }
+
+#ifndef WARPX_DIM_RZ
+    /** FiniteDifferenceSolver::EvolveB, without embedded boundaries
+     *
+     * With line_kernels=false, the Yee update uses the point-wise kernels
+     * (as on GPU) instead of the vectorized line kernels. */
+    template <ElectromagneticSolverAlgo algo, bool line_kernels = true>
+    void EvolveBBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        const auto cell_size = warpx::bench::SyntheticCellSize();
+        SyntheticFields f(params.ncell, 2);
+        FiniteDifferenceSolver solver(algo, cell_size, GridType::Staggered);
+        solver.SetLineKernels(line_kernels);
+        const amrex::Real dt = TimeStep(cell_size);
+
+        std::array< std::unique_ptr<amrex::iMultiFab>, 3 > flag_info_cell;
+        std::array< std::unique_ptr<amrex::LayoutData<FaceInfoBox> >, 3 > borrowing;
+        while (state.KeepRunning()) {
+            solver.EvolveB(f.fields, 0, PatchType::fine, flag_info_cell, borrowing, dt);
+        }
+        state.SetItemsPerIteration(f.ba.numPts());
+    }
+
+    /** FiniteDifferenceSolver::EvolveE, without embedded boundaries
+     *
+     * With line_kernels=false, the Yee update uses the point-wise kernels
+     * (as on GPU) instead of the vectorized line kernels. */
+    template <ElectromagneticSolverAlgo algo, bool line_kernels = true>
+    void EvolveEBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        const auto cell_size = warpx::bench::SyntheticCellSize();
+        SyntheticFields f(params.ncell, 2);
+        FiniteDifferenceSolver solver(algo, cell_size, GridType::Staggered);
+        solver.SetLineKernels(line_kernels);
+        const amrex::Real dt = TimeStep(cell_size);
+
+        const std::array< std::unique_ptr<amrex::iMultiFab>, 3 > eb_update_E;
+        const ablastr::fields::VectorField Efield = f.fields.get_alldirs(FieldType::Efield_fp, 0);
+        while (state.KeepRunning()) {
+            solver.EvolveE(f.fields, 0, PatchType::fine, Efield, eb_update_E, dt);
+        }
+        state.SetItemsPerIteration(f.ba.numPts());
+    }
+#endif
+
+#if defined(WARPX_USE_FFT) && !defined(WARPX_DIM_RZ)
+    /** PSATD update of E and B, with (or without) the transforms between real and spectral space */
+    template <bool with_fft>
+    void PsatdBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        const auto cell_size = warpx::bench::SyntheticCellSize();
+        SyntheticFields f(params.ncell, 0);
+        const amrex::Real dt = TimeStep(cell_size);
+
+        // Cell size along the dimensions of the grid
+        amrex::RealVect dx;
+#if defined(WARPX_DIM_3D)
+        dx = amrex::RealVect(cell_size[0], cell_size[1], cell_size[2]);
+#elif defined(WARPX_DIM_XZ)
+        dx = amrex::RealVect(cell_size[0], cell_size[2]);
+#else
+        dx = amrex::RealVect(cell_size[2]);
+#endif
+        constexpr int norder = 16;
+        const amrex::Vector<amrex::Real> v_galilean = {0._rt, 0._rt, 0._rt};
+        const amrex::Vector<amrex::Real> v_comoving = {0._rt, 0._rt, 0._rt};
+        SpectralSolver solver(0, f.ba, f.dm, norder, norder, norder, GridType::Staggered,
+                              v_galilean, v_comoving, dx, dt,
+                              false, true, false, false,
+                              PSATDSolutionType::SecondOrder, JInTime::Constant, RhoInTime::Linear,
+                              false, false);
+        const SpectralFieldIndex& Idx = solver.m_spectral_index;
+
+        const ablastr::fields::VectorField E = f.fields.get_alldirs(FieldType::Efield_fp, 0);
+        const ablastr::fields::VectorField B = f.fields.get_alldirs(FieldType::Bfield_fp, 0);
+        const ablastr::fields::VectorField J = f.fields.get_alldirs(FieldType::current_fp, 0);
+        const std::array<int,3> idx_E = {Idx.Ex, Idx.Ey, Idx.Ez};
+        const std::array<int,3> idx_B = {Idx.Bx, Idx.By, Idx.Bz};
+        const std::array<int,3> idx_J = {Idx.Jx_mid, Idx.Jy_mid, Idx.Jz_mid};
+        for (int dir = 0; dir < 3; ++dir) {
+            solver.ForwardTransform(0, *E[dir], idx_E[dir]);
+            solver.ForwardTransform(0, *B[dir], idx_B[dir]);
+            solver.ForwardTransform(0, *J[dir], idx_J[dir]);
+        }
+
+        while (state.KeepRunning()) {
+            if constexpr (with_fft) {
+                for (int dir = 0; dir < 3; ++dir) {
+                    solver.ForwardTransform(0, *E[dir], idx_E[dir]);
+                    solver.ForwardTransform(0, *B[dir], idx_B[dir]);
+                    solver.ForwardTransform(0, *J[dir], idx_J[dir]);
+                }
+            }
+            solver.pushSpectralFields();
+            if constexpr (with_fft) {
+                for (int dir = 0; dir < 3; ++dir) {
+                    solver.BackwardTransform(0, *E[dir], idx_E[dir], amrex::IntVect(0));
+                    solver.BackwardTransform(0, *B[dir], idx_B[dir], amrex::IntVect(0));
+                }
+            }
+        }
+        state.SetItemsPerIteration(f.ba.numPts());
+    }
+#endif
+}
+
+void
+warpx::bench::RegisterFieldBenchmarks ()
+{
+#ifndef WARPX_DIM_RZ
+    // The cylindrical solver requires an initialized WarpX instance
+    RegisterBenchmark("fdtd_evolve_b/yee", "cells", EvolveBBenchmark<ElectromagneticSolverAlgo::Yee>);
+    RegisterBenchmark("fdtd_evolve_e/yee", "cells", EvolveEBenchmark<ElectromagneticSolverAlgo::Yee>);
+    RegisterBenchmark("fdtd_evolve_b/yee_pointwise", "cells", EvolveBBenchmark<ElectromagneticSolverAlgo::Yee, false>);
+    RegisterBenchmark("fdtd_evolve_e/yee_pointwise", "cells", EvolveEBenchmark<ElectromagneticSolverAlgo::Yee, false>);
+    RegisterBenchmark("fdtd_evolve_b/ckc", "cells", EvolveBBenchmark<ElectromagneticSolverAlgo::CKC>);
+    RegisterBenchmark("fdtd_evolve_e/ckc", "cells", EvolveEBenchmark<ElectromagneticSolverAlgo::CKC>);
+#endif
+#if defined(WARPX_USE_FFT) && !defined(WARPX_DIM_RZ)
+    RegisterBenchmark("psatd/push_spectral", "cells", PsatdBenchmark<false>);
+    RegisterBenchmark("psatd/push_with_fft", "cells", PsatdBenchmark<true>);
+#endif
+}
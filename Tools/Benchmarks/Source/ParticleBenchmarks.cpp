@@ -0,0 +1,215 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "Benchmark.H"
+#include "BenchmarkList.H"
+#include "SyntheticData.H"
+
+#include "Particles/Deposition/CurrentDeposition.H"
+#include "Particles/Gather/FieldGather.H"
+#include "Particles/NamedComponentParticleContainer.H"
+#include "Particles/Pusher/GetAndSetPosition.H"
+#include "Particles/Pusher/UpdateMomentumBoris.H"
+#include "Particles/Pusher/UpdateMomentumHigueraCary.H"
+#include "Particles/Pusher/UpdateMomentumVay.H"
+#include "Particles/Pusher/UpdatePosition.H"
+#include "Utils/WarpXConst.H"
+
+#include <AMReX_Array4.H>
+#include <AMReX_GpuLaunch.H>
+
+#include <algorithm>
+#include <string>
+
+using namespace amrex::literals;
+
+namespace
+{
+    using warpx::bench::State;
+    using warpx::bench::SyntheticGrid;
+    using warpx::bench::SyntheticParticles;
+
+    //! species of the synthetic particles: electrons
+    constexpr auto charge = static_cast<amrex::ParticleReal>(-PhysConst::q_e);
+    constexpr auto mass = static_cast<amrex::ParticleReal>(PhysConst::m_e);
+
+    /** Time step at half the Courant limit of the grid */
+    amrex::Real TimeStep (const SyntheticGrid& grid)
+    {
+        return 0.5_rt*std::min({grid.dx[0], grid.dx[1], grid.dx[2]})/PhysConst::c;
+    }
+
+    //! particle pushers
+    enum struct Pusher { Boris, Vay, HigueraCary };
+
+    /** Momentum and position push, with the fields at the positions of the particles given */
+    template <Pusher pusher>
+    void PushBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        const SyntheticGrid grid(params.ncell, 0);
+        SyntheticParticles particles(grid, params.ppc);
+        const amrex::Real dt = TimeStep(grid);
+        const amrex::ParticleReal q = charge;
+        const amrex::ParticleReal m = mass;
+
+        const long np = particles.numParticles();
+        auto& soa = particles.tile.GetStructOfArrays();
+        amrex::ParticleReal* const AMREX_RESTRICT ux = soa.GetRealData(PIdx::ux).dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT uy = soa.GetRealData(PIdx::uy).dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT uz = soa.GetRealData(PIdx::uz).dataPtr();
+        const amrex::ParticleReal* const AMREX_RESTRICT Ex = particles.Ep[0].dataPtr();
+        const amrex::ParticleReal* const AMREX_RESTRICT Ey = particles.Ep[1].dataPtr();
+        const amrex::ParticleReal* const AMREX_RESTRICT Ez = particles.Ep[2].dataPtr();
+        const amrex::ParticleReal* const AMREX_RESTRICT Bx = particles.Bp[0].dataPtr();
+        const amrex::ParticleReal* const AMREX_RESTRICT By = particles.Bp[1].dataPtr();
+        const amrex::ParticleReal* const AMREX_RESTRICT Bz = particles.Bp[2].dataPtr();
+        const auto GetPosition = GetParticlePosition<PIdx>(particles.accessor());
+        const auto SetPosition = SetParticlePosition<PIdx>(particles.accessor());
+
+        while (state.KeepRunning()) {
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (long ip) noexcept
+            {
+                if constexpr (pusher == Pusher::Boris) {
+                    UpdateMomentumBoris(ux[ip], uy[ip], uz[ip],
+                                        Ex[ip], Ey[ip], Ez[ip], Bx[ip], By[ip], Bz[ip], q, m, dt);
+                } else if constexpr (pusher == Pusher::Vay) {
+                    UpdateMomentumVay(ux[ip], uy[ip], uz[ip],
+                                      Ex[ip], Ey[ip], Ez[ip], Bx[ip], By[ip], Bz[ip], q, m, dt);
+                } else {
+                    UpdateMomentumHigueraCary(ux[ip], uy[ip], uz[ip],
+                                              Ex[ip], Ey[ip], Ez[ip], Bx[ip], By[ip], Bz[ip], q, m, dt);
+                }
+                amrex::ParticleReal xp, yp, zp;
+                GetPosition(ip, xp, yp, zp);
+                UpdatePosition(xp, yp, zp, ux[ip], uy[ip], uz[ip], dt);
+                SetPosition(ip, xp, yp, zp);
+            });
+        }
+        state.SetItemsPerIteration(np);
+    }
+
+    /** Energy-conserving field gather (doGatherShapeN) */
+    template <int depos_order>
+    void GatherBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        const SyntheticGrid grid(params.ncell, depos_order + 1);
+        SyntheticParticles particles(grid, params.ppc);
+
+        const long np = particles.numParticles();
+        amrex::ParticleReal* const AMREX_RESTRICT Exp = particles.Ep[0].dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT Eyp = particles.Ep[1].dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT Ezp = particles.Ep[2].dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT Bxp = particles.Bp[0].dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT Byp = particles.Bp[1].dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT Bzp = particles.Bp[2].dataPtr();
+        const auto GetPosition = GetParticlePosition<PIdx>(particles.accessor());
+
+        const amrex::Array4<const amrex::Real> ex_arr = grid.E[0].const_array();
+        const amrex::Array4<const amrex::Real> ey_arr = grid.E[1].const_array();
+        const amrex::Array4<const amrex::Real> ez_arr = grid.E[2].const_array();
+        const amrex::Array4<const amrex::Real> bx_arr = grid.B[0].const_array();
+        const amrex::Array4<const amrex::Real> by_arr = grid.B[1].const_array();
+        const amrex::Array4<const amrex::Real> bz_arr = grid.B[2].const_array();
+        const amrex::IndexType ex_type = grid.E[0].box().ixType();
+        const amrex::IndexType ey_type = grid.E[1].box().ixType();
+        const amrex::IndexType ez_type = grid.E[2].box().ixType();
+        const amrex::IndexType bx_type = grid.B[0].box().ixType();
+        const amrex::IndexType by_type = grid.B[1].box().ixType();
+        const amrex::IndexType bz_type = grid.B[2].box().ixType();
+        const amrex::XDim3 dinv = grid.dinv;
+        const amrex::XDim3 xyzmin = grid.xyzmin;
+        const amrex::Dim3 lo = grid.lo;
+
+        while (state.KeepRunning()) {
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (long ip) noexcept
+            {
+                amrex::ParticleReal xp, yp, zp;
+                GetPosition(ip, xp, yp, zp);
+                Exp[ip] = 0._prt; Eyp[ip] = 0._prt; Ezp[ip] = 0._prt;
+                Bxp[ip] = 0._prt; Byp[ip] = 0._prt; Bzp[ip] = 0._prt;
+                doGatherShapeN<depos_order, 0>(
+                    xp, yp, zp, Exp[ip], Eyp[ip], Ezp[ip], Bxp[ip], Byp[ip], Bzp[ip],
+                    ex_arr, ey_arr, ez_arr, bx_arr, by_arr, bz_arr,
+                    ex_type, ey_type, ez_type, bx_type, by_type, bz_type,
+                    dinv, xyzmin, lo, 1);
+            });
+        }
+        state.SetItemsPerIteration(np);
+    }
+
+    /** Direct current deposition (doDepositionShapeN) */
+    template <int depos_order>
+    void DirectDepositionBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        SyntheticGrid grid(params.ncell, depos_order + 1);
+        SyntheticParticles particles(grid, params.ppc);
+
+        const long np = particles.numParticles();
+        const auto& soa = particles.tile.GetStructOfArrays();
+        const auto GetPosition = GetParticlePosition<PIdx>(particles.accessor());
+
+        while (state.KeepRunning()) {
+            doDepositionShapeN<depos_order>(
+                GetPosition, soa.GetRealData(PIdx::w).dataPtr(),
+                soa.GetRealData(PIdx::ux).dataPtr(), soa.GetRealData(PIdx::uy).dataPtr(),
+                soa.GetRealData(PIdx::uz).dataPtr(), nullptr,
+                grid.J[0], grid.J[1], grid.J[2], np, 0._rt,
+                grid.dinv, grid.xyzmin, grid.lo, static_cast<amrex::Real>(charge), 1);
+        }
+        state.SetItemsPerIteration(np);
+    }
+
+    /** Charge-conserving current deposition (doEsirkepovDepositionShapeN) */
+    template <int depos_order>
+    void EsirkepovDepositionBenchmark (State& state)
+    {
+        const auto params = warpx::bench::GetSyntheticParameters();
+        SyntheticGrid grid(params.ncell, depos_order + 2);
+        SyntheticParticles particles(grid, params.ppc);
+        const amrex::Real dt = TimeStep(grid);
+
+        const long np = particles.numParticles();
+        const auto& soa = particles.tile.GetStructOfArrays();
+        const auto GetPosition = GetParticlePosition<PIdx>(particles.accessor());
+
+        while (state.KeepRunning()) {
+            doEsirkepovDepositionShapeN<depos_order>(
+                GetPosition, soa.GetRealData(PIdx::w).dataPtr(),
+                soa.GetRealData(PIdx::ux).dataPtr(), soa.GetRealData(PIdx::uy).dataPtr(),
+                soa.GetRealData(PIdx::uz).dataPtr(), nullptr,
+                grid.J[0].array(), grid.J[1].array(), grid.J[2].array(), np, dt, 0._rt,
+                grid.dinv, grid.xyzmin, grid.lo, static_cast<amrex::Real>(charge), 1,
+                amrex::Array4<const int>{}, false);
+        }
+        state.SetItemsPerIteration(np);
+    }
+
+    template <int depos_order>
+    void RegisterShapeBenchmarks ()
+    {
+        const std::string shape = "/shape_" + std::to_string(depos_order);
+        warpx::bench::RegisterBenchmark("gather" + shape, "particles", GatherBenchmark<depos_order>);
+        warpx::bench::RegisterBenchmark("deposition_direct" + shape, "particles",
+            DirectDepositionBenchmark<depos_order>);
+        warpx::bench::RegisterBenchmark("deposition_esirkepov" + shape, "particles",
+            EsirkepovDepositionBenchmark<depos_order>);
+    }
+}
+
+void
+warpx::bench::RegisterParticleBenchmarks ()
+{
+    RegisterBenchmark("push/boris", "particles", PushBenchmark<Pusher::Boris>);
+    RegisterBenchmark("push/vay", "particles", PushBenchmark<Pusher::Vay>);
+    RegisterBenchmark("push/higuera_cary", "particles", PushBenchmark<Pusher::HigueraCary>);
+
+    RegisterShapeBenchmarks<1>();
+    RegisterShapeBenchmarks<2>();
+    RegisterShapeBenchmarks<3>();
+}
@@ -0,0 +1,168 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "SyntheticData.H"
+
+#include "Particles/NamedComponentParticleContainer.H"
+#include "Utils/Parser/ParserUtils.H"
+#include "Utils/TextMsg.H"
+#include "Utils/WarpXConst.H"
+
+#include <AMReX_GpuLaunch.H>
+#include <AMReX_IntVect.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Random.H>
+
+#include <cmath>
+
+using namespace amrex::literals;
+
+namespace
+{
+    /** Index of the direction dir (0,1,2 for x,y,z) among the dimensions of the grid, or -1 */
+    int GridDirection (int dir)
+    {
+#if defined(WARPX_DIM_3D)
+        return dir;
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+        return (dir == 0) ? 0 : ((dir == 2) ? 1 : -1);
+#else
+        return (dir == 2) ? 0 : -1;
+#endif
+    }
+
+    /** Fills a field with smooth values of the given amplitude */
+    void FillField (amrex::FArrayBox& fab, amrex::Real amplitude, int dir)
+    {
+        const auto arr = fab.array();
+        const amrex::Real phase = 0.7_rt*static_cast<amrex::Real>(dir);
+        amrex::ParallelFor(fab.box(), fab.nComp(),
+            [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+            {
+                arr(i, j, k, n) = amplitude*std::sin(0.1_rt*static_cast<amrex::Real>(i + 2*j + 3*k) + phase);
+            });
+    }
+}
+
+namespace warpx::bench
+{
+    SyntheticParameters
+    GetSyntheticParameters ()
+    {
+        SyntheticParameters params;
+        const amrex::ParmParse pp_bench("bench");
+        utils::parser::queryWithParser(pp_bench, "ncell", params.ncell);
+        utils::parser::queryWithParser(pp_bench, "ppc", params.ppc);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(params.ncell > 0 && params.ppc > 0,
+            "bench.ncell and bench.ppc must be positive");
+        return params;
+    }
+
+    std::array<amrex::Real,3>
+    SyntheticCellSize ()
+    {
+        constexpr amrex::Real cell_size = 1.e-6_rt;
+        std::array<amrex::Real,3> dx = {1._rt, 1._rt, 1._rt};
+        for (int dir = 0; dir < 3; ++dir) {
+            if (GridDirection(dir) >= 0) { dx[dir] = cell_size; }
+        }
+        return dx;
+    }
+
+    amrex::IndexType
+    YeeEType (int dir)
+    {
+        amrex::IntVect iv = amrex::IntVect::TheNodeVector();
+        const int d = GridDirection(dir);
+        if (d >= 0) { iv[d] = 0; }
+        return amrex::IndexType(iv);
+    }
+
+    amrex::IndexType
+    YeeBType (int dir)
+    {
+        amrex::IntVect iv = amrex::IntVect::TheCellVector();
+        const int d = GridDirection(dir);
+        if (d >= 0) { iv[d] = 1; }
+        return amrex::IndexType(iv);
+    }
+
+    SyntheticGrid::SyntheticGrid (int ncell, int nguard)
+        : box{amrex::IntVect(0), amrex::IntVect(ncell - 1)}, dx{SyntheticCellSize()}
+    {
+        dinv = amrex::XDim3{1._rt/dx[0], 1._rt/dx[1], 1._rt/dx[2]};
+        xyzmin = amrex::XDim3{0._rt, 0._rt, 0._rt};
+        lo = amrex::lbound(box);
+
+        const int ncomp = 1;
+        for (int dir = 0; dir < 3; ++dir) {
+            const amrex::Box ebox = amrex::grow(amrex::convert(box, YeeEType(dir)), nguard);
+            const amrex::Box bbox = amrex::grow(amrex::convert(box, YeeBType(dir)), nguard);
+            E[dir].resize(ebox, ncomp);
+            B[dir].resize(bbox, ncomp);
+            J[dir].resize(ebox, ncomp);
+            FillField(E[dir], 1.e9_rt, dir);
+            FillField(B[dir], 1._rt, dir);
+            J[dir].setVal<amrex::RunOn::Device>(0._rt);
+        }
+    }
+
+    SyntheticParticles::SyntheticParticles (const SyntheticGrid& grid, int ppc)
+    {
+        const auto np = static_cast<long>(grid.box.numPts())*ppc;
+        tile.define(0, 0);
+        tile.resize(np);
+        for (int dir = 0; dir < 3; ++dir) {
+            Ep[dir].resize(np, 0._prt);
+            Bp[dir].resize(np, 0._prt);
+        }
+
+        auto& soa = tile.GetStructOfArrays();
+        std::array<amrex::ParticleReal,3> L = {0._prt, 0._prt, 0._prt};
+        for (int dir = 0; dir < 3; ++dir) {
+            const int d = GridDirection(dir);
+            if (d >= 0) { L[dir] = static_cast<amrex::ParticleReal>(grid.box.length(d)*grid.dx[dir]); }
+        }
+        const amrex::ParticleReal Lx = L[0], Ly = L[1], Lz = L[2];
+        amrex::ParticleReal* const AMREX_RESTRICT w = soa.GetRealData(PIdx::w).dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT ux = soa.GetRealData(PIdx::ux).dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT uy = soa.GetRealData(PIdx::uy).dataPtr();
+        amrex::ParticleReal* const AMREX_RESTRICT uz = soa.GetRealData(PIdx::uz).dataPtr();
+#if !defined(WARPX_DIM_1D_Z)
+        amrex::ParticleReal* const AMREX_RESTRICT x = soa.GetRealData(PIdx::x).dataPtr();
+#endif
+#if defined(WARPX_DIM_3D)
+        amrex::ParticleReal* const AMREX_RESTRICT y = soa.GetRealData(PIdx::y).dataPtr();
+#endif
+        amrex::ParticleReal* const AMREX_RESTRICT z = soa.GetRealData(PIdx::z).dataPtr();
+#if defined(WARPX_DIM_RZ)
+        amrex::ParticleReal* const AMREX_RESTRICT theta = soa.GetRealData(PIdx::theta).dataPtr();
+#endif
+        amrex::ignore_unused(Lx, Ly);
+
+        // Uniform positions in the box, and non-relativistic random momenta
+        constexpr auto u_th = static_cast<amrex::ParticleReal>(0.05*PhysConst::c);
+        amrex::ParallelForRNG(np,
+            [=] AMREX_GPU_DEVICE (long ip, amrex::RandomEngine const& engine) noexcept
+            {
+#if !defined(WARPX_DIM_1D_Z)
+                x[ip] = Lx*static_cast<amrex::ParticleReal>(amrex::Random(engine));
+#endif
+#if defined(WARPX_DIM_3D)
+                y[ip] = Ly*static_cast<amrex::ParticleReal>(amrex::Random(engine));
+#endif
+                z[ip] = Lz*static_cast<amrex::ParticleReal>(amrex::Random(engine));
+#if defined(WARPX_DIM_RZ)
+                theta[ip] = static_cast<amrex::ParticleReal>(2._rt*MathConst::pi*amrex::Random(engine));
+#endif
+                w[ip] = 1.e10_prt;
+                ux[ip] = u_th*static_cast<amrex::ParticleReal>(amrex::RandomNormal(0., 1., engine));
+                uy[ip] = u_th*static_cast<amrex::ParticleReal>(amrex::RandomNormal(0., 1., engine));
+                uz[ip] = u_th*static_cast<amrex::ParticleReal>(amrex::RandomNormal(0., 1., engine));
+            });
+        amrex::Gpu::streamSynchronize();
+    }
+}
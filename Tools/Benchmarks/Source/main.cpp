@@ -0,0 +1,72 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "Benchmark.H"
+#include "BenchmarkList.H"
+
+#include "Initialization/WarpXInit.H"
+#include "Utils/Parser/ParserUtils.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+
+#include <string>
+
+/* Micro-benchmarks of the core kernels of WarpX on synthetic data.
+ *
+ * Runtime parameters (prefix "bench", given on the command line or in an inputs file):
+ *   filter         run only the benchmarks whose name contains this string
+ *   min_iterations minimum number of timed iterations of each benchmark (default: 10)
+ *   min_time       minimum duration of the timed iterations, in seconds (default: 0.5)
+ *   ncell          number of cells in each direction of the synthetic box (default: 32)
+ *   ppc            number of macroparticles per cell (default: 8)
+ *   baseline       file with the throughput of a previous run, to detect regressions
+ *   tolerance      relative decrease of the throughput reported as a regression (default: 0.1)
+ *   save_baseline  file where the throughput of this run is written
+ *
+ * The executable returns a non-zero exit code if a regression is detected.
+ */
+int main(int argc, char* argv[])
+{
+    warpx::initialization::initialize_external_libraries(argc, argv);
+    int num_regressions = 0;
+    {
+        const amrex::ParmParse pp_bench("bench");
+        std::string filter;
+        int min_iterations = 10;
+        double min_time = 0.5;
+        std::string baseline_file;
+        std::string save_baseline_file;
+        double tolerance = 0.1;
+        pp_bench.query("filter", filter);
+        utils::parser::queryWithParser(pp_bench, "min_iterations", min_iterations);
+        utils::parser::queryWithParser(pp_bench, "min_time", min_time);
+        pp_bench.query("baseline", baseline_file);
+        pp_bench.query("save_baseline", save_baseline_file);
+        utils::parser::queryWithParser(pp_bench, "tolerance", tolerance);
+
+        warpx::bench::RegisterParticleBenchmarks();
+        warpx::bench::RegisterFieldBenchmarks();
+
+        const auto results = warpx::bench::RunBenchmarks(filter, min_iterations, min_time);
+        warpx::bench::PrintResults(results);
+
+        if (!baseline_file.empty()) {
+            amrex::Print() << "\nThroughput relative to the baseline " << baseline_file << ":\n";
+            num_regressions = warpx::bench::CompareToBaseline(
+                results, warpx::bench::ReadBaseline(baseline_file), tolerance);
+            // The regressions detected on the I/O rank are the reference
+            amrex::ParallelDescriptor::Bcast(&num_regressions, 1,
+                amrex::ParallelDescriptor::IOProcessorNumber());
+        }
+        if (!save_baseline_file.empty()) {
+            warpx::bench::WriteBaseline(save_baseline_file, results);
+        }
+    }
+    warpx::initialization::finalize_external_libraries();
+    return (num_regressions > 0) ? 1 : 0;
+}